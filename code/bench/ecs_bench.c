@@ -0,0 +1,267 @@
+/**
+ * ecs_bench.c
+ * Micro-benchmarks du gestionnaire d'entités
+ *
+ * Mesure création, recherche d'entité et de composant, requêtes par masque et
+ * renouvellement (destruction + création) de 1k à 1M entités, pour plusieurs
+ * combinaisons de composants et les deux modes de stockage.
+ *
+ * Compilation (depuis code/) :
+ *   cc -O2 -o ecs_bench bench/ecs_bench.c src/systems/entity_manager.c \
+ *      src/systems/archetype.c src/core/entity.c src/utils/error_handler.c
+ *
+ * Utilisation : ecs_bench [nombre_max_d_entités]
+ *
+ * Sortie CSV sur stdout, une ligne par mesure :
+ *   benchmark,storage,mix,entities,ops,ns_per_op,cache_misses_per_op
+ * cache_misses_per_op vaut -1 si les compteurs matériels sont indisponibles
+ * (hors Linux, ou perf_event_paranoid trop restrictif).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../src/systems/entity_manager.h"
+#include "../src/utils/error_handler.h"
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+// Nombre de recherches effectuées par mesure
+#define LOOKUPS_PER_RUN 1000000
+
+// Nombre d'entités parcourues au total par la mesure des requêtes
+#define QUERY_ENTITIES_PER_RUN 20000000
+
+// Combinaison de composants attachée à chaque entité
+typedef struct {
+    const char* name;        // Nom affiché dans la sortie
+    ComponentMask mask;      // Composants (et étiquettes) de l'entité
+    ComponentType lookup;    // Composant lu par la mesure get_component
+} ComponentMix;
+
+static const ComponentMix mixes[] = {
+    { "transform", COMPONENT_BIT(COMPONENT_TRANSFORM), COMPONENT_TRANSFORM },
+    { "physics", COMPONENT_BIT(COMPONENT_TRANSFORM) | COMPONENT_BIT(COMPONENT_COLLIDER),
+      COMPONENT_COLLIDER },
+    { "render", COMPONENT_BIT(COMPONENT_TRANSFORM) | COMPONENT_BIT(COMPONENT_SPRITE) |
+      COMPONENT_BIT(COMPONENT_ANIMATION), COMPONENT_SPRITE },
+    { "crop", COMPONENT_BIT(COMPONENT_TRANSFORM) | COMPONENT_BIT(COMPONENT_FARMING) |
+      COMPONENT_BIT(COMPONENT_INTERACTABLE) | COMPONENT_BIT(COMPONENT_TAG_WATERED), COMPONENT_FARMING },
+};
+
+static const struct {
+    const char* name;
+    EntityStorageMode mode;
+} storages[] = {
+    { "pools", ENTITY_STORAGE_POOLS },
+    { "archetypes", ENTITY_STORAGE_ARCHETYPES },
+};
+
+// Compteur de défauts de cache (descripteur perf, -1 si indisponible)
+static int cache_counter = -1;
+
+// Horloge monotone en nanosecondes
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// Petit générateur pseudo-aléatoire (xorshift) pour des accès non séquentiels
+static uint32_t rng_state = 2463534242u;
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Ouvre le compteur matériel de défauts de cache du thread courant
+static void cache_counter_open(void) {
+#ifdef __linux__
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    cache_counter = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+    if (cache_counter < 0) {
+        log_warning("Compteur de défauts de cache indisponible : colonne cache_misses_per_op à -1");
+    }
+}
+
+// Remet à zéro et démarre le compteur
+static void cache_counter_start(void) {
+#ifdef __linux__
+    if (cache_counter < 0) return;
+    ioctl(cache_counter, PERF_EVENT_IOC_RESET, 0);
+    ioctl(cache_counter, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+}
+
+// Arrête le compteur et renvoie le nombre de défauts (-1 si indisponible)
+static long long cache_counter_stop(void) {
+#ifdef __linux__
+    if (cache_counter < 0) return -1;
+    ioctl(cache_counter, PERF_EVENT_IOC_DISABLE, 0);
+
+    long long misses = 0;
+    if (read(cache_counter, &misses, sizeof(misses)) != (ssize_t)sizeof(misses)) return -1;
+    return misses;
+#else
+    return -1;
+#endif
+}
+
+// Mesure en cours : horloge et compteur démarrés ensemble
+typedef struct {
+    double start_ns;
+} Measure;
+
+static void measure_begin(Measure* measure) {
+    cache_counter_start();
+    measure->start_ns = now_ns();
+}
+
+// Termine une mesure et écrit sa ligne CSV
+static void measure_end(Measure* measure, const char* benchmark, const char* storage,
+                        const ComponentMix* mix, int entities, long long ops) {
+    double elapsed = now_ns() - measure->start_ns;
+    long long misses = cache_counter_stop();
+    if (ops <= 0) ops = 1;
+
+    printf("%s,%s,%s,%d,%lld,%.2f,%.3f\n", benchmark, storage, mix->name, entities, ops,
+           elapsed / (double)ops, misses < 0 ? -1.0 : (double)misses / (double)ops);
+    fflush(stdout);
+}
+
+// Crée une entité avec tous les composants et étiquettes de la combinaison
+static EntityID spawn(EntityManager* manager, const ComponentMix* mix) {
+    EntityID id = entity_create(manager);
+    if (id == INVALID_ENTITY_ID) return id;
+
+    for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+        if (!HAS_COMPONENT(mix->mask, type)) continue;
+
+        if (IS_TAG_COMPONENT(type)) {
+            entity_set_tag(manager, id, (ComponentType)type, true);
+        } else {
+            entity_emplace_component(manager, id, (ComponentType)type);
+        }
+    }
+    return id;
+}
+
+// Exécute toutes les mesures pour un mode de stockage, une combinaison et une taille
+static void bench_run(const char* storage, EntityStorageMode mode, const ComponentMix* mix, int entity_count) {
+    EntityManager* manager = entity_manager_init_with_storage(mode);
+    if (!manager) return;
+
+    EntityID* ids = (EntityID*)malloc(entity_count * sizeof(EntityID));
+    EntityID* found = (EntityID*)malloc(entity_count * sizeof(EntityID));
+    if (!ids || !found) {
+        log_error("Échec d'allocation pour %d entités", entity_count);
+        free(ids);
+        free(found);
+        entity_manager_shutdown(manager);
+        return;
+    }
+
+    Measure measure;
+
+    // Création entité par entité, composants compris
+    measure_begin(&measure);
+    int created = 0;
+    for (; created < entity_count; created++) {
+        ids[created] = spawn(manager, mix);
+        if (ids[created] == INVALID_ENTITY_ID) break;
+    }
+    measure_end(&measure, "create", storage, mix, entity_count, created);
+    if (created == 0) goto cleanup;
+
+    // Recherche d'entité seule (masque de composants)
+    volatile uint32_t mask_sink = 0;
+    measure_begin(&measure);
+    for (int i = 0; i < LOOKUPS_PER_RUN; i++) {
+        mask_sink += entity_get_mask(manager, ids[next_random() % created]);
+    }
+    measure_end(&measure, "get_mask", storage, mix, created, LOOKUPS_PER_RUN);
+    (void)mask_sink;
+
+    // Recherche d'entité puis de composant, à des positions aléatoires
+    volatile uintptr_t component_sink = 0;
+    measure_begin(&measure);
+    for (int i = 0; i < LOOKUPS_PER_RUN; i++) {
+        component_sink += (uintptr_t)entity_get_component(manager, ids[next_random() % created], mix->lookup);
+    }
+    measure_end(&measure, "get_component", storage, mix, created, LOOKUPS_PER_RUN);
+    (void)component_sink;
+
+    // Requête par masque : coût d'un appel complet
+    int query_runs = QUERY_ENTITIES_PER_RUN / created;
+    if (query_runs < 1) query_runs = 1;
+    volatile int query_sink = 0;
+    measure_begin(&measure);
+    for (int i = 0; i < query_runs; i++) {
+        query_sink += entity_find_with_components(manager, mix->mask, found, created);
+    }
+    measure_end(&measure, "find_with_components", storage, mix, created, query_runs);
+    (void)query_sink;
+
+    // Renouvellement : détruire une entité au hasard et la remplacer
+    measure_begin(&measure);
+    for (int i = 0; i < created; i++) {
+        int slot = (int)(next_random() % created);
+        entity_destroy(manager, ids[slot]);
+        ids[slot] = spawn(manager, mix);
+    }
+    measure_end(&measure, "destroy_churn", storage, mix, created, created);
+
+    // Destruction complète
+    measure_begin(&measure);
+    for (int i = 0; i < created; i++) {
+        entity_destroy(manager, ids[i]);
+    }
+    measure_end(&measure, "destroy", storage, mix, created, created);
+
+cleanup:
+    free(ids);
+    free(found);
+    entity_manager_shutdown(manager);
+}
+
+int main(int argc, char** argv) {
+    int max_entities = argc > 1 ? atoi(argv[1]) : 1000000;
+
+    // Ne pas polluer la mesure avec les journaux d'information
+    g_current_log_level = LOG_LEVEL_WARNING;
+
+    cache_counter_open();
+    printf("benchmark,storage,mix,entities,ops,ns_per_op,cache_misses_per_op\n");
+
+    int sizes[] = { 1000, 10000, 100000, 1000000 };
+    for (size_t s = 0; s < sizeof(storages) / sizeof(storages[0]); s++) {
+        for (size_t m = 0; m < sizeof(mixes) / sizeof(mixes[0]); m++) {
+            for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+                if (sizes[i] > max_entities) break;
+                bench_run(storages[s].name, storages[s].mode, &mixes[m], sizes[i]);
+            }
+        }
+    }
+
+#ifdef __linux__
+    if (cache_counter >= 0) close(cache_counter);
+#endif
+    return EXIT_SUCCESS;
+}
@@ -16,12 +16,9 @@ static void initialize_component_base(Component* base, ComponentType type, Entit
     }
 }
 
-// Crée un composant Transform
-TransformComponent* create_transform_component(EntityID entity_id, float x, float y) {
-    TransformComponent* component = (TransformComponent*)calloc(1, sizeof(TransformComponent));
-    if (!check_ptr(component, LOG_LEVEL_ERROR, "Échec d'allocation du composant Transform")) {
-        return NULL;
-    }
+// Initialise un composant Transform déjà alloué
+void init_transform_component(TransformComponent* component, EntityID entity_id, float x, float y) {
+    if (!component) return;
     
     initialize_component_base(&component->base, COMPONENT_TRANSFORM, entity_id);
     
@@ -31,16 +28,35 @@ TransformComponent* create_transform_component(EntityID entity_id, float x, floa
     component->scale_x = 1.0f;
     component->scale_y = 1.0f;
     
-    return component;
+    // Pas de déplacement à interpoler avant le premier pas de simulation
+    component->previous_x = x;
+    component->previous_y = y;
 }
 
-// Crée un composant Sprite
-SpriteComponent* create_sprite_component(EntityID entity_id, uint32_t texture_id, int width, int height) {
-    SpriteComponent* component = (SpriteComponent*)calloc(1, sizeof(SpriteComponent));
-    if (!check_ptr(component, LOG_LEVEL_ERROR, "Échec d'allocation du composant Sprite")) {
+// Calcule la position à afficher entre les deux derniers pas de simulation
+void interpolate_transform_component(const TransformComponent* component, float alpha, float* out_x, float* out_y) {
+    if (!component || !out_x || !out_y) return;
+    
+    *out_x = component->previous_x + (component->x - component->previous_x) * alpha;
+    *out_y = component->previous_y + (component->y - component->previous_y) * alpha;
+}
+
+// Crée un composant Transform
+TransformComponent* create_transform_component(EntityID entity_id, float x, float y) {
+    TransformComponent* component = (TransformComponent*)calloc(1, sizeof(TransformComponent));
+    if (!check_ptr(component, LOG_LEVEL_ERROR, "Échec d'allocation du composant Transform")) {
         return NULL;
     }
     
+    init_transform_component(component, entity_id, x, y);
+    
+    return component;
+}
+
+// Initialise un composant Sprite déjà alloué
+void init_sprite_component(SpriteComponent* component, EntityID entity_id, uint32_t texture_id, int width, int height) {
+    if (!component) return;
+    
     initialize_component_base(&component->base, COMPONENT_SPRITE, entity_id);
     
     component->texture_id = texture_id;
@@ -50,17 +66,24 @@ SpriteComponent* create_sprite_component(EntityID entity_id, uint32_t texture_id
     component->sprite_sheet_y = 0;
     component->z_order = 0;
     component->visible = true;
-    
-    return component;
 }
 
-// Crée un composant Collider
-ColliderComponent* create_collider_component(EntityID entity_id, float width, float height, CollisionType collision_type) {
-    ColliderComponent* component = (ColliderComponent*)calloc(1, sizeof(ColliderComponent));
-    if (!check_ptr(component, LOG_LEVEL_ERROR, "Échec d'allocation du composant Collider")) {
+// Crée un composant Sprite
+SpriteComponent* create_sprite_component(EntityID entity_id, uint32_t texture_id, int width, int height) {
+    SpriteComponent* component = (SpriteComponent*)calloc(1, sizeof(SpriteComponent));
+    if (!check_ptr(component, LOG_LEVEL_ERROR, "Échec d'allocation du composant Sprite")) {
         return NULL;
     }
     
+    init_sprite_component(component, entity_id, texture_id, width, height);
+    
+    return component;
+}
+
+// Initialise un composant Collider déjà alloué
+void init_collider_component(ColliderComponent* component, EntityID entity_id, float width, float height, CollisionType collision_type) {
+    if (!component) return;
+    
     initialize_component_base(&component->base, COMPONENT_COLLIDER, entity_id);
     
     component->width = width;
@@ -71,17 +94,24 @@ ColliderComponent* create_collider_component(EntityID entity_id, float width, fl
     component->collision_mask = 0xFFFFFFFF;  // Par défaut, collisionne avec tout
     component->collision_layer = 1;          // Couche par défaut
     component->is_trigger = (collision_type == COLLISION_TRIGGER);
-    
-    return component;
 }
 
-// Crée un composant Animation
-AnimationComponent* create_animation_component(EntityID entity_id) {
-    AnimationComponent* component = (AnimationComponent*)calloc(1, sizeof(AnimationComponent));
-    if (!check_ptr(component, LOG_LEVEL_ERROR, "Échec d'allocation du composant Animation")) {
+// Crée un composant Collider
+ColliderComponent* create_collider_component(EntityID entity_id, float width, float height, CollisionType collision_type) {
+    ColliderComponent* component = (ColliderComponent*)calloc(1, sizeof(ColliderComponent));
+    if (!check_ptr(component, LOG_LEVEL_ERROR, "Échec d'allocation du composant Collider")) {
         return NULL;
     }
     
+    init_collider_component(component, entity_id, width, height, collision_type);
+    
+    return component;
+}
+
+// Initialise un composant Animation déjà alloué
+void init_animation_component(AnimationComponent* component, EntityID entity_id) {
+    if (!component) return;
+    
     initialize_component_base(&component->base, COMPONENT_ANIMATION, entity_id);
     
     // Initialiser les animations à NULL
@@ -94,17 +124,24 @@ AnimationComponent* create_animation_component(EntityID entity_id) {
     component->current_frame = 0;
     component->is_playing = false;
     component->loop = true;
-    
-    return component;
 }
 
-// Crée un composant Player
-PlayerComponent* create_player_component(EntityID entity_id, float move_speed) {
-    PlayerComponent* component = (PlayerComponent*)calloc(1, sizeof(PlayerComponent));
-    if (!check_ptr(component, LOG_LEVEL_ERROR, "Échec d'allocation du composant Player")) {
+// Crée un composant Animation
+AnimationComponent* create_animation_component(EntityID entity_id) {
+    AnimationComponent* component = (AnimationComponent*)calloc(1, sizeof(AnimationComponent));
+    if (!check_ptr(component, LOG_LEVEL_ERROR, "Échec d'allocation du composant Animation")) {
         return NULL;
     }
     
+    init_animation_component(component, entity_id);
+    
+    return component;
+}
+
+// Initialise un composant Player déjà alloué
+void init_player_component(PlayerComponent* component, EntityID entity_id, float move_speed) {
+    if (!component) return;
+    
     initialize_component_base(&component->base, COMPONENT_PLAYER, entity_id);
     
     component->move_speed = move_speed;
@@ -112,17 +149,24 @@ PlayerComponent* create_player_component(EntityID entity_id, float move_speed) {
     component->max_stamina = 100;
     component->health = 100;
     component->max_health = 100;
-    
-    return component;
 }
 
-// Crée un composant Farming
-FarmingComponent* create_farming_component(EntityID entity_id, int crop_type) {
-    FarmingComponent* component = (FarmingComponent*)calloc(1, sizeof(FarmingComponent));
-    if (!check_ptr(component, LOG_LEVEL_ERROR, "Échec d'allocation du composant Farming")) {
+// Crée un composant Player
+PlayerComponent* create_player_component(EntityID entity_id, float move_speed) {
+    PlayerComponent* component = (PlayerComponent*)calloc(1, sizeof(PlayerComponent));
+    if (!check_ptr(component, LOG_LEVEL_ERROR, "Échec d'allocation du composant Player")) {
         return NULL;
     }
     
+    init_player_component(component, entity_id, move_speed);
+    
+    return component;
+}
+
+// Initialise un composant Farming déjà alloué
+void init_farming_component(FarmingComponent* component, EntityID entity_id, int crop_type) {
+    if (!component) return;
+    
     initialize_component_base(&component->base, COMPONENT_FARMING, entity_id);
     
     component->crop_type = crop_type;
@@ -132,17 +176,24 @@ FarmingComponent* create_farming_component(EntityID entity_id, int crop_type) {
     component->water_level = 0.0f;
     component->is_watered = false;
     component->is_harvestable = false;
-    
-    return component;
 }
 
-// Crée un composant Item
-ItemComponent* create_item_component(EntityID entity_id, int item_id, int stack_size) {
-    ItemComponent* component = (ItemComponent*)calloc(1, sizeof(ItemComponent));
-    if (!check_ptr(component, LOG_LEVEL_ERROR, "Échec d'allocation du composant Item")) {
+// Crée un composant Farming
+FarmingComponent* create_farming_component(EntityID entity_id, int crop_type) {
+    FarmingComponent* component = (FarmingComponent*)calloc(1, sizeof(FarmingComponent));
+    if (!check_ptr(component, LOG_LEVEL_ERROR, "Échec d'allocation du composant Farming")) {
         return NULL;
     }
     
+    init_farming_component(component, entity_id, crop_type);
+    
+    return component;
+}
+
+// Initialise un composant Item déjà alloué
+void init_item_component(ItemComponent* component, EntityID entity_id, int item_id, int stack_size) {
+    if (!component) return;
+    
     initialize_component_base(&component->base, COMPONENT_ITEM, entity_id);
     
     component->item_id = item_id;
@@ -151,10 +202,31 @@ ItemComponent* create_item_component(EntityID entity_id, int item_id, int stack_
     component->is_tool = false;
     component->tool_type = 0;
     component->tool_level = 0;
+}
+
+// Crée un composant Item
+ItemComponent* create_item_component(EntityID entity_id, int item_id, int stack_size) {
+    ItemComponent* component = (ItemComponent*)calloc(1, sizeof(ItemComponent));
+    if (!check_ptr(component, LOG_LEVEL_ERROR, "Échec d'allocation du composant Item")) {
+        return NULL;
+    }
+    
+    init_item_component(component, entity_id, item_id, stack_size);
     
     return component;
 }
 
+// Initialise un composant Interactable déjà alloué
+void init_interactable_component(InteractableComponent* component, EntityID entity_id, int interaction_type, float interaction_radius) {
+    if (!component) return;
+    
+    initialize_component_base(&component->base, COMPONENT_INTERACTABLE, entity_id);
+    
+    component->interaction_type = interaction_type;
+    component->interaction_radius = interaction_radius;
+    component->is_active = true;
+}
+
 // Crée un composant Interactable
 InteractableComponent* create_interactable_component(EntityID entity_id, int interaction_type, float interaction_radius) {
     InteractableComponent* component = (InteractableComponent*)calloc(1, sizeof(InteractableComponent));
@@ -162,11 +234,7 @@ InteractableComponent* create_interactable_component(EntityID entity_id, int int
         return NULL;
     }
     
-    initialize_component_base(&component->base, COMPONENT_INTERACTABLE, entity_id);
-    
-    component->interaction_type = interaction_type;
-    component->interaction_radius = interaction_radius;
-    component->is_active = true;
+    init_interactable_component(component, entity_id, interaction_type, interaction_radius);
     
     return component;
 }
\ No newline at end of file
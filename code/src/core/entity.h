@@ -9,12 +9,28 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-// ID d'entité unique
+// ID d'entité unique : index d'emplacement (bits de poids faible) + génération (bits de poids fort)
 typedef uint32_t EntityID;
 
-// ID d'entité invalide
+// ID d'entité invalide (l'index 0 n'est jamais attribué)
 #define INVALID_ENTITY_ID 0
 
+// Découpage d'un ID d'entité
+#define ENTITY_INDEX_BITS 22
+#define ENTITY_GENERATION_BITS (32 - ENTITY_INDEX_BITS)
+#define ENTITY_INDEX_MASK ((1u << ENTITY_INDEX_BITS) - 1)
+#define ENTITY_GENERATION_MASK ((1u << ENTITY_GENERATION_BITS) - 1)
+
+// Génération réservée aux ID provisoires (jamais attribuée par le gestionnaire d'entités)
+#define ENTITY_PENDING_GENERATION ENTITY_GENERATION_MASK
+
+// Macros pour composer et décomposer un ID d'entité
+#define ENTITY_INDEX(id) ((uint32_t)(id) & ENTITY_INDEX_MASK)
+#define ENTITY_GENERATION(id) ((uint32_t)(id) >> ENTITY_INDEX_BITS)
+#define MAKE_ENTITY_ID(index, generation) \
+    ((EntityID)((((uint32_t)(generation) & ENTITY_GENERATION_MASK) << ENTITY_INDEX_BITS) | \
+                ((uint32_t)(index) & ENTITY_INDEX_MASK)))
+
 // Types de composants disponibles
 typedef enum {
     COMPONENT_TRANSFORM,     // Position, rotation, échelle
@@ -27,6 +43,11 @@ typedef enum {
     COMPONENT_INTERACTABLE,  // Objets interactifs
     COMPONENT_ANIMATION,     // Animation
     
+    // Tags : aucune donnée, seulement un bit dans le masque de l'entité
+    COMPONENT_TAG_WATERED,      // Arrosé aujourd'hui
+    COMPONENT_TAG_HARVESTABLE,  // Prêt à être récolté
+    COMPONENT_TAG_TRIGGER,      // Zone de déclenchement
+    
     // Toujours ajouter de nouveaux types avant cette ligne
     COMPONENT_TYPE_COUNT     // Nombre total de types de composants
 } ComponentType;
@@ -48,6 +69,12 @@ typedef uint32_t ComponentMask;
 #define ADD_COMPONENT(mask, type) ((mask) | COMPONENT_BIT(type))
 #define REMOVE_COMPONENT(mask, type) ((mask) & ~COMPONENT_BIT(type))
 
+// Types de composants sans données (tags) : ni pool, ni colonne d'archétype
+#define TAG_COMPONENT_MASK (COMPONENT_BIT(COMPONENT_TAG_WATERED) | \
+                            COMPONENT_BIT(COMPONENT_TAG_HARVESTABLE) | \
+                            COMPONENT_BIT(COMPONENT_TAG_TRIGGER))
+#define IS_TAG_COMPONENT(type) HAS_COMPONENT(TAG_COMPONENT_MASK, type)
+
 // Structure de base pour un composant
 typedef struct {
     ComponentType type;  // Type du composant
@@ -60,6 +87,7 @@ typedef struct {
     float x, y;           // Position
     float rotation;       // Rotation en degrés
     float scale_x, scale_y; // Échelle
+    float previous_x, previous_y; // Position au début du dernier pas de simulation (interpolation du rendu)
 } TransformComponent;
 
 // Composant Sprite (représentation visuelle)
@@ -157,6 +185,24 @@ typedef struct {
  */
 TransformComponent* create_transform_component(EntityID entity_id, float x, float y);
 
+/**
+ * Initialise en place un composant Transform (par exemple dans le stockage du gestionnaire)
+ * @param component Composant à initialiser
+ * @param entity_id ID de l'entité
+ * @param x Position X
+ * @param y Position Y
+ */
+void init_transform_component(TransformComponent* component, EntityID entity_id, float x, float y);
+
+/**
+ * Calcule la position à afficher entre les deux derniers pas de simulation
+ * @param component Composant Transform
+ * @param alpha Fraction du pas fixe écoulée depuis le dernier pas (0 à 1)
+ * @param out_x Position X interpolée
+ * @param out_y Position Y interpolée
+ */
+void interpolate_transform_component(const TransformComponent* component, float alpha, float* out_x, float* out_y);
+
 /**
  * Crée un composant Sprite
  * @param entity_id ID de l'entité
@@ -167,6 +213,16 @@ TransformComponent* create_transform_component(EntityID entity_id, float x, floa
  */
 SpriteComponent* create_sprite_component(EntityID entity_id, uint32_t texture_id, int width, int height);
 
+/**
+ * Initialise en place un composant Sprite (par exemple dans le stockage du gestionnaire)
+ * @param component Composant à initialiser
+ * @param entity_id ID de l'entité
+ * @param texture_id ID de la texture
+ * @param width Largeur
+ * @param height Hauteur
+ */
+void init_sprite_component(SpriteComponent* component, EntityID entity_id, uint32_t texture_id, int width, int height);
+
 /**
  * Crée un composant Collider
  * @param entity_id ID de l'entité
@@ -177,6 +233,16 @@ SpriteComponent* create_sprite_component(EntityID entity_id, uint32_t texture_id
  */
 ColliderComponent* create_collider_component(EntityID entity_id, float width, float height, CollisionType collision_type);
 
+/**
+ * Initialise en place un composant Collider (par exemple dans le stockage du gestionnaire)
+ * @param component Composant à initialiser
+ * @param entity_id ID de l'entité
+ * @param width Largeur
+ * @param height Hauteur
+ * @param collision_type Type de collision
+ */
+void init_collider_component(ColliderComponent* component, EntityID entity_id, float width, float height, CollisionType collision_type);
+
 /**
  * Crée un composant Animation
  * @param entity_id ID de l'entité
@@ -184,6 +250,13 @@ ColliderComponent* create_collider_component(EntityID entity_id, float width, fl
  */
 AnimationComponent* create_animation_component(EntityID entity_id);
 
+/**
+ * Initialise en place un composant Animation (par exemple dans le stockage du gestionnaire)
+ * @param component Composant à initialiser
+ * @param entity_id ID de l'entité
+ */
+void init_animation_component(AnimationComponent* component, EntityID entity_id);
+
 /**
  * Crée un composant Player
  * @param entity_id ID de l'entité
@@ -192,6 +265,14 @@ AnimationComponent* create_animation_component(EntityID entity_id);
  */
 PlayerComponent* create_player_component(EntityID entity_id, float move_speed);
 
+/**
+ * Initialise en place un composant Player (par exemple dans le stockage du gestionnaire)
+ * @param component Composant à initialiser
+ * @param entity_id ID de l'entité
+ * @param move_speed Vitesse de déplacement
+ */
+void init_player_component(PlayerComponent* component, EntityID entity_id, float move_speed);
+
 /**
  * Crée un composant Farming
  * @param entity_id ID de l'entité
@@ -200,6 +281,14 @@ PlayerComponent* create_player_component(EntityID entity_id, float move_speed);
  */
 FarmingComponent* create_farming_component(EntityID entity_id, int crop_type);
 
+/**
+ * Initialise en place un composant Farming (par exemple dans le stockage du gestionnaire)
+ * @param component Composant à initialiser
+ * @param entity_id ID de l'entité
+ * @param crop_type Type de culture
+ */
+void init_farming_component(FarmingComponent* component, EntityID entity_id, int crop_type);
+
 /**
  * Crée un composant Item
  * @param entity_id ID de l'entité
@@ -209,6 +298,15 @@ FarmingComponent* create_farming_component(EntityID entity_id, int crop_type);
  */
 ItemComponent* create_item_component(EntityID entity_id, int item_id, int stack_size);
 
+/**
+ * Initialise en place un composant Item (par exemple dans le stockage du gestionnaire)
+ * @param component Composant à initialiser
+ * @param entity_id ID de l'entité
+ * @param item_id ID de l'objet
+ * @param stack_size Taille de la pile
+ */
+void init_item_component(ItemComponent* component, EntityID entity_id, int item_id, int stack_size);
+
 /**
  * Crée un composant Interactable
  * @param entity_id ID de l'entité
@@ -218,4 +316,13 @@ ItemComponent* create_item_component(EntityID entity_id, int item_id, int stack_
  */
 InteractableComponent* create_interactable_component(EntityID entity_id, int interaction_type, float interaction_radius);
 
+/**
+ * Initialise en place un composant Interactable (par exemple dans le stockage du gestionnaire)
+ * @param component Composant à initialiser
+ * @param entity_id ID de l'entité
+ * @param interaction_type Type d'interaction
+ * @param interaction_radius Rayon d'interaction
+ */
+void init_interactable_component(InteractableComponent* component, EntityID entity_id, int interaction_type, float interaction_radius);
+
 #endif /* ENTITY_H */
\ No newline at end of file
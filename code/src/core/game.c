@@ -7,6 +7,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <math.h>
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 
@@ -23,8 +24,20 @@
 #define DEFAULT_SCREEN_HEIGHT 720
 #define INTERNAL_WIDTH 640
 #define INTERNAL_HEIGHT 360
-#define TARGET_FPS 60
-#define MS_PER_FRAME (1000 / TARGET_FPS)
+
+// Pas de simulation fixe (60 pas par seconde)
+#define FIXED_TIMESTEP (1.0f / 60.0f)
+
+// Temps réel maximal pris en compte par frame (débogage, lags)
+#define MAX_FRAME_TIME 0.25
+
+// Nombre maximal de pas simulés par frame : au-delà, le retard est abandonné
+#define MAX_STEPS_PER_FRAME 8
+
+// Mise à jour du système de monde pour l'ordonnanceur
+static void game_update_world(void* context, float delta_time) {
+    world_system_update((WorldSystem*)context, delta_time);
+}
 
 // Initialise le contexte de jeu et tous les sous-systèmes
 GameContext* game_init(void) {
@@ -38,9 +51,15 @@ GameContext* game_init(void) {
     game->running = true;
     game->screen_width = DEFAULT_SCREEN_WIDTH;
     game->screen_height = DEFAULT_SCREEN_HEIGHT;
-    game->last_update_time = 0;
-    game->delta_time = 0.0f;
+    game->last_counter = 0;
+    game->accumulator = 0.0;
+    game->delta_time = FIXED_TIMESTEP;
+    game->interpolation_alpha = 0.0f;
+    game->vsync = false;
+    game->step_tick = 0;
     game->phase3_systems = NULL; // Initialisation du pointeur des systèmes de phase 3
+    game->job_system = NULL;
+    game->scheduler = NULL;
     
     // Initialiser SDL
     if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_TIMER) != 0) {
@@ -90,6 +109,14 @@ GameContext* game_init(void) {
         return NULL;
     }
     
+    // La synchronisation verticale peut être refusée par le pilote : vérifier ce qui a été obtenu
+    SDL_RendererInfo renderer_info;
+    game->vsync = SDL_GetRendererInfo(game->renderer, &renderer_info) == 0 &&
+                  (renderer_info.flags & SDL_RENDERER_PRESENTVSYNC) != 0;
+    if (!game->vsync) {
+        log_warning("Synchronisation verticale indisponible, la boucle attendra chaque pas de simulation");
+    }
+    
     // Initialiser le système de rendu
     game->render_system = render_system_init(game->renderer);
     if (!check_ptr(game->render_system, LOG_LEVEL_FATAL, "Échec d'initialisation du système de rendu")) {
@@ -132,6 +159,12 @@ GameContext* game_init(void) {
         // Continuer quand même, ce n'est pas une erreur fatale
     }
     
+    // Initialiser le système de jobs (un thread par cœur disponible)
+    game->job_system = job_system_init(-1);
+    if (!game->job_system) {
+        log_warning("Système de jobs indisponible, les mises à jour resteront sur le thread principal");
+    }
+    
     // Initialiser les systèmes de la phase 3
     game->phase3_systems = phase3_init(game);
     if (!check_ptr(game->phase3_systems, LOG_LEVEL_ERROR, "Échec d'initialisation des systèmes de la phase 3")) {
@@ -139,12 +172,25 @@ GameContext* game_init(void) {
         log_warning("Les fonctionnalités de la phase 3 ne seront pas disponibles");
     }
     
+    // Initialiser l'ordonnanceur des systèmes sur les threads du système de jobs
+    game->scheduler = scheduler_init(game->job_system);
+    if (game->scheduler) {
+        // Le monde touche la carte, la caméra et le temps : il s'exécute seul
+        scheduler_add_system(game->scheduler, "world", game_update_world, game->world_system,
+                             0, 0, true);
+        if (game->phase3_systems) {
+            phase3_register_systems(game->phase3_systems, game->scheduler);
+        }
+    } else {
+        log_warning("Ordonnanceur indisponible, les systèmes seront mis à jour séquentiellement");
+    }
+    
     // Charger les textures de base
     // Note: cette partie serait normalement gérée par un système de ressources,
     // mais pour simplifier, nous le faisons ici pour le prototype.
     
     // Initialiser le temps de la dernière mise à jour
-    game->last_update_time = SDL_GetTicks();
+    game->last_counter = SDL_GetPerformanceCounter();
     
     log_info("Jeu initialisé avec succès");
     return game;
@@ -226,31 +272,62 @@ void game_handle_events(GameContext* game) {
 void game_update(GameContext* game) {
     if (!game) return;
     
-    // Calculer le delta time
-    uint32_t current_time = SDL_GetTicks();
-    game->delta_time = (current_time - game->last_update_time) / 1000.0f;
-    game->last_update_time = current_time;
-    
-    // Limiter le delta time à une valeur maximale pour éviter les sauts trop grands
-    // pendant le débogage ou les lags
-    const float MAX_DELTA_TIME = 0.1f;
-    if (game->delta_time > MAX_DELTA_TIME) {
-        game->delta_time = MAX_DELTA_TIME;
+    // Sans synchronisation verticale, rien ne cadence les frames : attendre le pas
+    // suivant plutôt que d'occuper un cœur à 100 %
+    if (!game->vsync) {
+        double elapsed = (double)(SDL_GetPerformanceCounter() - game->last_counter) / (double)SDL_GetPerformanceFrequency();
+        double remaining = FIXED_TIMESTEP - (game->accumulator + elapsed);
+        if (remaining > 0.0) {
+            SDL_Delay((Uint32)(remaining * 1000.0));
+        }
     }
     
-    // Mettre à jour les systèmes
-    world_system_update(game->world_system, game->delta_time);
+    // Accumuler le temps réel écoulé depuis la frame précédente
+    uint64_t current_counter = SDL_GetPerformanceCounter();
+    double frame_time = (double)(current_counter - game->last_counter) / (double)SDL_GetPerformanceFrequency();
+    game->last_counter = current_counter;
     
-    // Mettre à jour les systèmes de la phase 3
-    if (game->phase3_systems) {
-        phase3_update(game->phase3_systems, game->delta_time);
+    // Limiter le temps pris en compte pour éviter les sauts trop grands
+    // pendant le débogage ou les lags
+    if (frame_time > MAX_FRAME_TIME) {
+        frame_time = MAX_FRAME_TIME;
+    }
+    game->accumulator += frame_time;
+    
+    // Simuler par pas fixes : même coût et même résultat quelle que soit la fréquence d'affichage
+    int steps = 0;
+    while (game->accumulator >= FIXED_TIMESTEP && steps < MAX_STEPS_PER_FRAME) {
+        // Positions de début de pas, pour interpoler le rendu entre ce pas et le suivant
+        entity_manager_store_previous_transforms(game->entity_manager, game->step_tick);
+        
+        // Nouveau pas : les composants modifiés à partir d'ici portent un nouveau tick
+        game->step_tick = entity_manager_advance_tick(game->entity_manager);
+        
+        // Mettre à jour les systèmes (en parallèle quand leurs accès le permettent)
+        if (game->scheduler) {
+            scheduler_run(game->scheduler, FIXED_TIMESTEP);
+        } else {
+            world_system_update(game->world_system, FIXED_TIMESTEP);
+            
+            // Mettre à jour les systèmes de la phase 3
+            if (game->phase3_systems) {
+                phase3_update(game->phase3_systems, FIXED_TIMESTEP);
+            }
+        }
+        
+        game->accumulator -= FIXED_TIMESTEP;
+        steps++;
     }
     
-    // Limiter le taux de rafraîchissement
-    uint32_t frame_time = SDL_GetTicks() - current_time;
-    if (frame_time < MS_PER_FRAME) {
-        SDL_Delay(MS_PER_FRAME - frame_time);
+    // Trop de retard : abandonner les pas entiers restants plutôt que de s'enliser
+    if (game->accumulator >= FIXED_TIMESTEP) {
+        log_debug("Simulation en retard, %.1f ms abandonnées", game->accumulator * 1000.0);
+        game->accumulator = fmod(game->accumulator, FIXED_TIMESTEP);
     }
+    
+    // Position du rendu entre le dernier pas et le suivant ; le rythme des frames
+    // est donné par la synchronisation verticale du renderer, ou à défaut par l'attente ci-dessus
+    game->interpolation_alpha = (float)(game->accumulator / FIXED_TIMESTEP);
 }
 
 // Rend le jeu à l'écran
@@ -259,7 +336,8 @@ void game_render(GameContext* game) {
     
     // Rendre le monde à travers le système de monde
     // Notre système de rendu avec résolution interne gère maintenant l'effacement et la présentation
-    world_system_render(game->world_system, game->render_system);
+    // Les Transform sont dessinés entre les deux derniers pas de simulation
+    world_system_render(game->world_system, game->render_system, game->interpolation_alpha);
     
     // Rendre les éléments visuels des systèmes de la phase 3
     if (game->phase3_systems) {
@@ -273,6 +351,17 @@ void game_shutdown(GameContext* game) {
     
     log_info("Fermeture du jeu en cours...");
     
+    if (game->scheduler) {
+        scheduler_shutdown(game->scheduler);
+        game->scheduler = NULL;
+    }
+    
+    // Arrêter les threads avant de libérer les systèmes qu'ils exécutent
+    if (game->job_system) {
+        job_system_shutdown(game->job_system);
+        game->job_system = NULL;
+    }
+    
     // Libérer les systèmes de la phase 3
     if (game->phase3_systems) {
         phase3_shutdown(game->phase3_systems);
@@ -13,6 +13,8 @@
 # include "../systems/render.h"
 # include "../systems/world.h"
 # include "../systems/entity_manager.h"
+# include "../systems/job_system.h"
+# include "../systems/scheduler.h"
 
 // Forward declaration pour éviter les inclusions circulaires
 typedef struct Phase3Systems Phase3Systems;
@@ -21,8 +23,12 @@ typedef struct Phase3Systems Phase3Systems;
 typedef struct GameContext
 {
 	bool			running;		//etat d'execution du jeu
-	uint32_t		last_update_time;//tmp last update pour delta time
-	float			delta_time;		//tmp ecoule depuis la derniere frame en sec
+	uint64_t		last_counter;	//compteur haute precision a la derniere frame
+	double			accumulator;	//temps reel pas encore simule en sec
+	float			delta_time;		//duree d'un pas de simulation en sec (fixe)
+	float			interpolation_alpha;//fraction du pas en cours, pour interpoler le rendu
+	bool			vsync;			//le renderer attend la synchronisation verticale
+	uint32_t		step_tick;		//tick du gestionnaire au debut du dernier pas
 	SDL_Window*		window;			//fentre SDL
 	SDL_Renderer*	renderer;		//renderer SDL
 	int				screen_width;	//largeur de l'ecran
@@ -31,6 +37,8 @@ typedef struct GameContext
 	WorldSystem*	world_system;	//systeme de gestion du monde
 	EntityManager*	entity_manager;	//gestionnaire d'entites
 	Phase3Systems*  phase3_systems; //systemes de la phase 3
+	JobSystem*		job_system;		//threads partages par les sous-systemes
+	SystemScheduler* scheduler;		//ordonnanceur des mises a jour des systemes
 	//ajouter d'autres sous-systemes au fur et a mesure, quete, inventaire, etc
 }	GameContext;
 
@@ -55,12 +63,17 @@ void			game_handle_events(GameContext* game);
 
 /*
  * Met a jour l'etat du jeu
+ * Le temps reel ecoule est accumule puis simule par pas fixes : le cout et le
+ * resultat de la simulation ne dependent pas de la frequence d'affichage.
+ * Le rendu interpole ensuite les Transform avec interpolation_alpha.
+ * Sans synchronisation verticale, attend d'abord le pas suivant.
  * @param game Contexte du jeu
 */
 void			game_update(GameContext* game);
 
 /*
  * Rend le jeu a l'ecran
+ * Les Transform sont dessines a leur position interpolee avec interpolation_alpha.
  * @param game Contexte du jeu
 */
 void			game_render(GameContext* game);
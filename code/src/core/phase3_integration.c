@@ -7,6 +7,14 @@
 #include "../core/phase3_integration.h"
 #include "../utils/error_handler.h"
 
+// Durée d'une journée de jeu en secondes réelles (environ 20 minutes)
+#define SECONDS_PER_GAME_DAY (20.0f * 60.0f)
+
+// Convertit un temps réel écoulé en fraction de journée pour le système de farming
+static inline float phase3_day_fraction(float delta_time) {
+    return delta_time / SECONDS_PER_GAME_DAY;
+}
+
 /**
  * Initialise les systèmes de la phase 3
  * @param game Contexte de jeu
@@ -29,6 +37,7 @@ Phase3Systems* phase3_init(GameContext* game) {
         free(systems);
         return NULL;
     }
+    systems->farming_system->job_system = game->job_system;
     
     // Initialiser le système d'outils
     systems->tools_system = tools_system_init(game->entity_manager, game->world_system);
@@ -101,9 +110,46 @@ void phase3_update(Phase3Systems* systems, float delta_time) {
     
     // Mettre à jour le système de farming
     // Pour le système de farming, le delta_time est converti en jours
-    // en supposant qu'une journée de jeu dure environ 20 minutes réelles
-    float day_fraction = delta_time / (20.0f * 60.0f);
-    farming_system_update(systems->farming_system, day_fraction);
+    farming_system_update(systems->farming_system, phase3_day_fraction(delta_time));
+}
+
+// Mise à jour du système d'inventaire pour l'ordonnanceur
+static void phase3_update_inventory(void* context, float delta_time) {
+    Phase3Systems* systems = (Phase3Systems*)context;
+    inventory_system_update(systems->inventory_system, delta_time);
+}
+
+// Mise à jour du système d'outils pour l'ordonnanceur
+static void phase3_update_tools(void* context, float delta_time) {
+    Phase3Systems* systems = (Phase3Systems*)context;
+    tools_system_update(systems->tools_system, delta_time);
+}
+
+// Mise à jour du système de farming pour l'ordonnanceur
+static void phase3_update_farming(void* context, float delta_time) {
+    Phase3Systems* systems = (Phase3Systems*)context;
+    farming_system_update(systems->farming_system, phase3_day_fraction(delta_time));
+}
+
+/**
+ * Enregistre les systèmes de la phase 3 dans l'ordonnanceur
+ * @param systems Systèmes de la phase 3
+ * @param scheduler Ordonnanceur
+ * @return true si tous les systèmes ont été enregistrés, false sinon
+ */
+bool phase3_register_systems(Phase3Systems* systems, SystemScheduler* scheduler) {
+    if (!systems || !systems->initialized || !scheduler) return false;
+    
+    // Le farming lit les tuiles de la carte courante : il doit être enregistré
+    // après la mise à jour du monde, qui est exclusive
+    bool success = true;
+    success &= scheduler_add_system(scheduler, "inventory", phase3_update_inventory, systems,
+                                    COMPONENT_BIT(COMPONENT_ITEM), 0, false) >= 0;
+    success &= scheduler_add_system(scheduler, "tools", phase3_update_tools, systems,
+                                    0, 0, false) >= 0;
+    success &= scheduler_add_system(scheduler, "farming", phase3_update_farming, systems,
+                                    0, COMPONENT_BIT(COMPONENT_FARMING), false) >= 0;
+    return success;
 }
 
 /**
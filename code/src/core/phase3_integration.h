@@ -9,6 +9,7 @@
 #include "../systems/farming_system.h"
 #include "../systems/tools_system.h"
 #include "../systems/inventory_system.h"
+#include "../systems/scheduler.h"
 #include "../core/game.h"
 
 // Structure pour regrouper les systèmes de la phase 3
@@ -39,6 +40,16 @@ void phase3_shutdown(Phase3Systems* systems);
  */
 void phase3_update(Phase3Systems* systems, float delta_time);
 
+/**
+ * Enregistre les systèmes de la phase 3 dans l'ordonnanceur
+ * Chaque système est enregistré séparément avec ses accès aux composants
+ * pour pouvoir s'exécuter en parallèle des autres.
+ * @param systems Systèmes de la phase 3
+ * @param scheduler Ordonnanceur
+ * @return true si tous les systèmes ont été enregistrés, false sinon
+ */
+bool phase3_register_systems(Phase3Systems* systems, SystemScheduler* scheduler);
+
 /**
  * Rend les éléments visuels des systèmes de la phase 3
  * @param systems Systèmes à rendre
@@ -12,6 +12,24 @@
 
 #define MAX_COLLISION_RESULTS 16
 
+// Côté d'une cellule de la phase large en pixels (plus grand que la plupart des colliders mobiles)
+#define PHYSICS_CELL_SIZE 64.0f
+
+// Nombre de seaux de la grille hachée
+#define PHYSICS_HASH_BUCKETS 4096
+
+// Taille initiale du tampon de candidats de la phase large
+#define INITIAL_CANDIDATE_CAPACITY 64
+
+// Écart laissé entre une boîte et la surface qu'elle heurte, en pixels
+#define PHYSICS_CONTACT_SKIN 0.01f
+
+// Conversion des degrés en radians (angles des zones d'effet)
+#define DEGREES_TO_RADIANS (3.14159265358979f / 180.0f)
+
+// Nombre de colliders statiques ajoutés en une synchronisation au-delà duquel l'arbre est reconstruit
+#define STATIC_REBUILD_BATCH 64
+
 // Initialise le système de physique
 PhysicsSystem* physics_system_init(EntityManager* entity_manager) {
     if (!check_ptr(entity_manager, LOG_LEVEL_ERROR, "Entity manager NULL passé à physics_system_init")) {
@@ -24,6 +42,29 @@ PhysicsSystem* physics_system_init(EntityManager* entity_manager) {
     }
 
     system->entity_manager = entity_manager;
+
+    // Vue tenue à jour par le gestionnaire : aucun rescan des masques par requête
+    system->collider_query = entity_query_register(
+        entity_manager, COMPONENT_BIT(COMPONENT_TRANSFORM) | COMPONENT_BIT(COMPONENT_COLLIDER)
+    );
+    if (!check_ptr(system->collider_query, LOG_LEVEL_ERROR, "Échec d'enregistrement de la vue des colliders")) {
+        free(system);
+        return NULL;
+    }
+    
+    // Les sorties de la vue pilotent les retraits de la phase large
+    entity_query_track_removed(system->collider_query);
+    
+    // Les contacts des déclencheurs ne parcourent que les colliders tagués
+    system->trigger_query = entity_query_register(
+        entity_manager, COMPONENT_BIT(COMPONENT_TRANSFORM) | COMPONENT_BIT(COMPONENT_COLLIDER) |
+                        COMPONENT_BIT(COMPONENT_TAG_TRIGGER)
+    );
+    if (!check_ptr(system->trigger_query, LOG_LEVEL_ERROR, "Échec d'enregistrement de la vue des déclencheurs")) {
+        free(system);
+        return NULL;
+    }
+
     system->max_collision_results = MAX_COLLISION_RESULTS;
     system->collision_results = (CollisionResult*)calloc(system->max_collision_results, sizeof(CollisionResult));
     
@@ -32,6 +73,25 @@ PhysicsSystem* physics_system_init(EntityManager* entity_manager) {
         return NULL;
     }
     
+    // Phase large : les requêtes ne visitent que les colliders des cellules voisines
+    system->broadphase = spatial_hash_init(PHYSICS_CELL_SIZE, PHYSICS_HASH_BUCKETS);
+    system->static_tree = aabb_tree_init();
+    system->dynamic_pairs = sweep_and_prune_init();
+    system->trigger_contacts = contact_cache_init();
+    system->candidate_capacity = INITIAL_CANDIDATE_CAPACITY;
+    system->candidates = (EntityID*)malloc(system->candidate_capacity * sizeof(EntityID));
+    if (!system->broadphase || !system->static_tree || !system->dynamic_pairs || !system->trigger_contacts ||
+        !check_ptr(system->candidates, LOG_LEVEL_ERROR, "Échec d'allocation des candidats de collision")) {
+        spatial_hash_shutdown(system->broadphase);
+        aabb_tree_shutdown(system->static_tree);
+        sweep_and_prune_shutdown(system->dynamic_pairs);
+        contact_cache_shutdown(system->trigger_contacts);
+        free(system->candidates);
+        free(system->collision_results);
+        free(system);
+        return NULL;
+    }
+    
     system->collision_results_count = 0;
     system->debug_draw = false;
     
@@ -48,11 +108,258 @@ void physics_system_shutdown(PhysicsSystem* system) {
         system->collision_results = NULL;
     }
     
+    spatial_hash_shutdown(system->broadphase);
+    aabb_tree_shutdown(system->static_tree);
+    sweep_and_prune_shutdown(system->dynamic_pairs);
+    contact_cache_shutdown(system->trigger_contacts);
+    free(system->candidates);
+    free(system->changed);
+    free(system->obstacle_boxes);
+    free(system->obstacle_entities);
     free(system);
     
     log_info("Système de physique libéré");
 }
 
+// Définit la carte dont les tuiles non traversables bloquent les déplacements
+void physics_system_set_tile_map(PhysicsSystem* system, const Map* map) {
+    if (!system) return;
+    system->tile_map = map;
+}
+
+// Calcule la boîte englobante à partir d'une position et d'un collider
+static void compute_bounds(const TransformComponent* transform, const ColliderComponent* collider, BoundingBox* box) {
+    box->x = transform->x + collider->offset_x - collider->width / 2.0f;
+    box->y = transform->y + collider->offset_y - collider->height / 2.0f;
+    box->width = collider->width;
+    box->height = collider->height;
+}
+
+// Composants d'un candidat de la phase large
+// La phase large n'est resynchronisée qu'à la mise à jour : un candidat détruit
+// ou privé de son collider depuis est ignoré sans avertissement
+static bool get_candidate_components(EntityManager* manager, EntityID entity_id,
+                                     TransformComponent** transform, ColliderComponent** collider) {
+    if (!entity_has_component(manager, entity_id, COMPONENT_COLLIDER) ||
+        !entity_has_component(manager, entity_id, COMPONENT_TRANSFORM)) {
+        return false;
+    }
+    
+    *transform = (TransformComponent*)entity_get_component(manager, entity_id, COMPONENT_TRANSFORM);
+    *collider = (ColliderComponent*)entity_get_component(manager, entity_id, COMPONENT_COLLIDER);
+    return *transform && *collider;
+}
+
+// Enregistre la boîte courante d'une entité dans la phase large
+// Les colliders statiques vont dans l'arbre, les autres dans la grille hachée
+static void broadphase_update_entity(
+    PhysicsSystem* system,
+    EntityID entity_id,
+    const TransformComponent* transform,
+    const ColliderComponent* collider
+) {
+    BoundingBox box;
+    compute_bounds(transform, collider, &box);
+    
+    if (collider->type == COLLISION_STATIC) {
+        spatial_hash_remove(system->broadphase, entity_id);
+        aabb_tree_insert(system->static_tree, entity_id, box.x, box.y, box.x + box.width, box.y + box.height);
+    } else {
+        aabb_tree_remove(system->static_tree, entity_id);
+        spatial_hash_update(system->broadphase, entity_id, box.x, box.y, box.x + box.width, box.y + box.height);
+    }
+    
+    // Seuls les colliders dynamiques forment des paires entre eux
+    if (collider->type == COLLISION_DYNAMIC) {
+        sweep_and_prune_set(system->dynamic_pairs, entity_id, box.x, box.y, box.x + box.width, box.y + box.height);
+    } else {
+        sweep_and_prune_remove(system->dynamic_pairs, entity_id);
+    }
+}
+
+// Indique si une entité est dans la vue des colliders (sans passer par son masque)
+static inline bool in_collider_query(const PhysicsSystem* system, EntityID entity_id) {
+    const EntityQuery* query = system->collider_query;
+    uint32_t index = ENTITY_INDEX(entity_id);
+    if (index >= system->entity_manager->sparse_capacity) return false;
+    
+    int position = query->sparse[index];
+    return position >= 0 && query->entities[position] == entity_id;
+}
+
+// Retire une entité de toutes les structures de la phase large
+static void broadphase_remove_entity(PhysicsSystem* system, EntityID entity_id) {
+    spatial_hash_remove(system->broadphase, entity_id);
+    aabb_tree_remove(system->static_tree, entity_id);
+    sweep_and_prune_remove(system->dynamic_pairs, entity_id);
+}
+
+// Resynchronisation complète : sorties de la vue perdues (mémoire, restauration d'une capture)
+static void broadphase_resync(PhysicsSystem* system) {
+    SpatialHash* hash = system->broadphase;
+    AabbTree* tree = system->static_tree;
+    SweepAndPrune* sap = system->dynamic_pairs;
+    
+    // Retirer ce qui n'est plus dans la vue (à rebours : la dernière boîte comble le trou)
+    for (int i = hash->entry_count - 1; i >= 0; i--) {
+        if (!in_collider_query(system, hash->entries[i].entity)) {
+            spatial_hash_remove(hash, hash->entries[i].entity);
+        }
+    }
+    for (int i = sap->body_count - 1; i >= 0; i--) {
+        if (!in_collider_query(system, sap->bodies[i].entity)) {
+            sweep_and_prune_remove(sap, sap->bodies[i].entity);
+        }
+    }
+    
+    // Un retrait de feuille ne déplace pas les autres feuilles
+    for (int i = 0; i < tree->node_count; i++) {
+        if (tree->nodes[i].height == 0 && !in_collider_query(system, tree->nodes[i].entity)) {
+            aabb_tree_remove(tree, tree->nodes[i].entity);
+        }
+    }
+    
+    // Réenregistrer toute la vue
+    const EntityID* entities = system->collider_query->entities;
+    for (int i = 0; i < system->collider_query->count; i++) {
+        TransformComponent* transform;
+        ColliderComponent* collider;
+        if (get_candidate_components(system->entity_manager, entities[i], &transform, &collider)) {
+            broadphase_update_entity(system, entities[i], transform, collider);
+        }
+    }
+    aabb_tree_rebuild(tree);
+}
+
+// Remplit le tampon des entités dont un composant a changé depuis un tick, en l'agrandissant si besoin
+static int gather_changed(PhysicsSystem* system, ComponentType type, uint32_t since_tick) {
+    for (;;) {
+        int count = system->changed_capacity > 0
+            ? entity_find_changed(system->entity_manager, type, since_tick, system->changed, system->changed_capacity)
+            : 0;
+        
+        // Tampon rempli : il y a peut-être d'autres entités, l'agrandir et refaire la recherche
+        if (count < system->changed_capacity) return count;
+        
+        int new_capacity = system->changed_capacity ? system->changed_capacity * 2 : INITIAL_CANDIDATE_CAPACITY;
+        EntityID* new_changed = (EntityID*)realloc(system->changed, new_capacity * sizeof(EntityID));
+        if (!check_ptr(new_changed, LOG_LEVEL_WARNING, "Échec d'agrandissement des entités modifiées")) {
+            return count;
+        }
+        system->changed = new_changed;
+        system->changed_capacity = new_capacity;
+    }
+}
+
+// Répercute sur la phase large les colliders ajoutés, retirés ou déplacés depuis la dernière synchronisation
+static void broadphase_sync(PhysicsSystem* system) {
+    EntityManager* manager = system->entity_manager;
+    EntityQuery* colliders = system->collider_query;
+    uint32_t since_tick = system->broadphase_tick;
+    system->broadphase_tick = manager->change_tick;
+    
+    if (colliders->removed_overflow) {
+        entity_query_clear_removed(colliders);
+        broadphase_resync(system);
+        return;
+    }
+    
+    // Retirer les entités détruites ou privées de collider depuis la dernière synchronisation
+    for (int i = 0; i < colliders->removed_count; i++) {
+        broadphase_remove_entity(system, colliders->removed[i]);
+    }
+    entity_query_clear_removed(colliders);
+    
+    // Ajouter les nouveaux colliders et déplacer ceux dont le Transform ou le Collider a changé
+    int static_inserted = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        ComponentType type = pass == 0 ? COMPONENT_TRANSFORM : COMPONENT_COLLIDER;
+        int changed_count = gather_changed(system, type, since_tick);
+        
+        for (int i = 0; i < changed_count; i++) {
+            EntityID entity_id = system->changed[i];
+            
+            // Les Transform modifiés incluent les entités sans collider
+            if (!in_collider_query(system, entity_id)) continue;
+            
+            // Transform et Collider modifiés ensemble : déjà traité au premier passage
+            if (type == COMPONENT_COLLIDER &&
+                entity_get_change_tick(manager, entity_id, COMPONENT_TRANSFORM) >= since_tick) {
+                continue;
+            }
+            
+            TransformComponent* transform;
+            ColliderComponent* collider;
+            if (!get_candidate_components(manager, entity_id, &transform, &collider)) continue;
+            
+            broadphase_update_entity(system, entity_id, transform, collider);
+            if (collider->type == COLLISION_STATIC) static_inserted++;
+        }
+    }
+    
+    // Chargement de carte : un arbre construit d'un bloc est mieux équilibré que par insertions
+    if (static_inserted >= STATIC_REBUILD_BATCH) {
+        aabb_tree_rebuild(system->static_tree);
+    }
+}
+
+// Teste la collision entre une boîte de référence et le collider d'une autre entité
+static bool test_collider_pair(
+    const BoundingBox* entity_box,
+    const ColliderComponent* entity_collider,
+    EntityID other_id,
+    const TransformComponent* other_transform,
+    const ColliderComponent* other_collider,
+    CollisionResult* result
+) {
+    // Vérifier si les couches de collision sont compatibles
+    if ((entity_collider->collision_mask & other_collider->collision_layer) == 0) {
+        return false;
+    }
+    
+    BoundingBox other_box;
+    compute_bounds(other_transform, other_collider, &other_box);
+    
+    if (!physics_check_box_collision(entity_box, &other_box, result)) {
+        return false;
+    }
+    
+    result->entity = other_id;
+    result->type = other_collider->type;
+    return true;
+}
+
+// Dessine la boîte englobante d'un collider avec la couleur de son type
+static void draw_collider_box(RenderSystem* render_system, const BoundingBox* box, const ColliderComponent* collider) {
+    // Choisir la couleur selon le type de collision
+    uint8_t r = 0, g = 0, b = 0, a = 255;
+    switch (collider->type) {
+        case COLLISION_STATIC:
+            r = 255; g = 0; b = 0;  // Rouge pour les objets statiques
+            break;
+        case COLLISION_DYNAMIC:
+            r = 0; g = 255; b = 0;  // Vert pour les objets dynamiques
+            break;
+        case COLLISION_TRIGGER:
+            r = 0; g = 0; b = 255;  // Bleu pour les triggers
+            break;
+        default:
+            r = 255; g = 255; b = 0;  // Jaune pour les autres
+            break;
+    }
+    
+    // Dessiner la boîte englobante
+    render_system_draw_rect(
+        render_system,
+        box->x + box->width / 2.0f,  // Centrer sur la position
+        box->y + box->height / 2.0f,
+        box->width,
+        box->height,
+        r, g, b, a,
+        false  // Non rempli
+    );
+}
+
 // Calcule la boîte englobante d'une entité
 bool physics_get_entity_bounds(PhysicsSystem* system, EntityID entity_id, BoundingBox* box) {
     if (!system || !box || entity_id == INVALID_ENTITY_ID) return false;
@@ -70,10 +377,7 @@ bool physics_get_entity_bounds(PhysicsSystem* system, EntityID entity_id, Boundi
     if (!transform || !collider) return false;
     
     // Calculer la boîte englobante
-    box->x = transform->x + collider->offset_x - collider->width / 2.0f;
-    box->y = transform->y + collider->offset_y - collider->height / 2.0f;
-    box->width = collider->width;
-    box->height = collider->height;
+    compute_bounds(transform, collider, box);
     
     return true;
 }
@@ -130,6 +434,87 @@ bool physics_check_box_collision(
     return true;
 }
 
+// Remplit le tampon des candidats avec la grille puis l'arbre des statiques
+// Renvoie le nombre total de candidats, qui peut dépasser la taille du tampon
+static int query_broadphase(PhysicsSystem* system, const BoundingBox* box) {
+    float max_x = box->x + box->width;
+    float max_y = box->y + box->height;
+    
+    int hash_count = spatial_hash_query(
+        system->broadphase, box->x, box->y, max_x, max_y,
+        system->candidates, system->candidate_capacity
+    );
+    int written = hash_count < system->candidate_capacity ? hash_count : system->candidate_capacity;
+    int tree_count = aabb_tree_query(
+        system->static_tree, box->x, box->y, max_x, max_y,
+        system->candidates + written, system->candidate_capacity - written
+    );
+    
+    return hash_count + tree_count;
+}
+
+// Remplit le tampon des candidats, en l'agrandissant si la requête ne tient pas
+static int gather_candidates(PhysicsSystem* system, const BoundingBox* box) {
+    int candidate_count = query_broadphase(system, box);
+    
+    // Tampon trop petit : l'agrandir et refaire la requête
+    if (candidate_count > system->candidate_capacity) {
+        int new_capacity = system->candidate_capacity;
+        while (new_capacity < candidate_count) {
+            new_capacity *= 2;
+        }
+        
+        EntityID* new_candidates = (EntityID*)realloc(system->candidates, new_capacity * sizeof(EntityID));
+        if (check_ptr(new_candidates, LOG_LEVEL_WARNING, "Échec d'agrandissement des candidats de collision")) {
+            system->candidates = new_candidates;
+            system->candidate_capacity = new_capacity;
+            candidate_count = query_broadphase(system, box);
+        }
+        if (candidate_count > system->candidate_capacity) {
+            candidate_count = system->candidate_capacity;
+        }
+    }
+    
+    return candidate_count;
+}
+
+// Cherche les colliders qui chevauchent une boîte parmi les candidats de la phase large
+static int collect_collisions(
+    PhysicsSystem* system,
+    EntityID entity_id,
+    const BoundingBox* box,
+    const ColliderComponent* collider,
+    CollisionResult* results,
+    int max_results
+) {
+    EntityManager* manager = system->entity_manager;
+    int candidate_count = gather_candidates(system, box);
+    
+    int collision_count = 0;
+    for (int i = 0; i < candidate_count && collision_count < max_results; i++) {
+        EntityID other_id = system->candidates[i];
+        
+        // Ne pas vérifier la collision avec soi-même
+        if (other_id == entity_id) {
+            continue;
+        }
+        
+        // La phase large est conservative : le test exact utilise les composants courants
+        TransformComponent* other_transform;
+        ColliderComponent* other_collider;
+        if (!get_candidate_components(manager, other_id, &other_transform, &other_collider)) {
+            continue;
+        }
+        
+        if (test_collider_pair(box, collider, other_id, other_transform, other_collider,
+                               &results[collision_count])) {
+            collision_count++;
+        }
+    }
+    
+    return collision_count;
+}
+
 // Vérifie si une entité est en collision avec d'autres entités
 int physics_check_entity_collisions(
     PhysicsSystem* system, 
@@ -156,60 +541,7 @@ int physics_check_entity_collisions(
         return 0;
     }
     
-    // Créer un masque de requête pour trouver les entités avec un collider
-    ComponentMask query_mask = COMPONENT_BIT(COMPONENT_TRANSFORM) | COMPONENT_BIT(COMPONENT_COLLIDER);
-    
-    // Tableau pour stocker les entités trouvées
-    EntityID entities[1024];
-    int entity_count = entity_find_with_components(
-        system->entity_manager, query_mask, entities, 1024
-    );
-    
-    // Nombre de collisions trouvées
-    int collision_count = 0;
-    
-    // Vérifier les collisions avec chaque entité
-    for (int i = 0; i < entity_count && collision_count < max_results; i++) {
-        EntityID other_id = entities[i];
-        
-        // Ne pas vérifier la collision avec soi-même
-        if (other_id == entity_id) {
-            continue;
-        }
-        
-        // Récupérer le collider de l'autre entité
-        ColliderComponent* other_collider = (ColliderComponent*)entity_get_component(
-            system->entity_manager, other_id, COMPONENT_COLLIDER
-        );
-        
-        if (!other_collider) {
-            continue;
-        }
-        
-        // Vérifier si les couches de collision sont compatibles
-        if ((entity_collider->collision_mask & other_collider->collision_layer) == 0) {
-            continue;
-        }
-        
-        // Récupérer la boîte englobante de l'autre entité
-        BoundingBox other_box;
-        if (!physics_get_entity_bounds(system, other_id, &other_box)) {
-            continue;
-        }
-        
-        // Vérifier la collision
-        CollisionResult result;
-        if (physics_check_box_collision(&entity_box, &other_box, &result)) {
-            // Stocker les informations de collision
-            result.entity = other_id;
-            result.type = other_collider->type;
-            
-            // Ajouter le résultat au tableau
-            results[collision_count++] = result;
-        }
-    }
-    
-    return collision_count;
+    return collect_collisions(system, entity_id, &entity_box, entity_collider, results, max_results);
 }
 
 // Vérifie si une position est valide pour une entité (sans collision)
@@ -224,7 +556,6 @@ bool physics_is_position_valid(
         return false;
     }
     
-    // Sauvegarder la position actuelle
     TransformComponent* transform = (TransformComponent*)entity_get_component(
         system->entity_manager, entity_id, COMPONENT_TRANSFORM
     );
@@ -233,20 +564,31 @@ bool physics_is_position_valid(
         return false;
     }
     
-    float original_x = transform->x;
-    float original_y = transform->y;
+    // Sans collider, l'entité ne peut rien heurter
+    ColliderComponent* collider = (ColliderComponent*)entity_get_component(
+        system->entity_manager, entity_id, COMPONENT_COLLIDER
+    );
+    
+    if (!collider) {
+        return true;
+    }
     
-    // Déplacer temporairement l'entité à la nouvelle position
-    transform->x = x;
-    transform->y = y;
+    // Boîte à la position testée, calculée sans toucher au Transform
+    TransformComponent moved = *transform;
+    moved.x = x;
+    moved.y = y;
+    BoundingBox box;
+    compute_bounds(&moved, collider, &box);
+    
+    // Les tuiles non traversables bloquent tout collider solide (quelques masques de bits par chunk)
+    if (system->tile_map && collider->type != COLLISION_TRIGGER &&
+        !world_map_is_area_walkable(system->tile_map, box.x, box.y, box.x + box.width, box.y + box.height)) {
+        return false;
+    }
     
     // Vérifier les collisions
     CollisionResult results[16];
-    int collision_count = physics_check_entity_collisions(system, entity_id, results, 16);
-    
-    // Restaurer la position originale
-    transform->x = original_x;
-    transform->y = original_y;
+    int collision_count = collect_collisions(system, entity_id, &box, collider, results, 16);
     
     // Si aucune collision ou seulement avec l'entité à ignorer, la position est valide
     if (collision_count == 0) {
@@ -263,12 +605,470 @@ bool physics_is_position_valid(
     return true;
 }
 
+// Test exact d'une forme de requête contre la boîte d'un candidat
+typedef bool (*QueryShapeTest)(const BoundingBox* box, const void* shape);
+
+// Cercle d'une requête
+typedef struct {
+    float x, y;              // Centre
+    float radius_sq;         // Carré du rayon
+} QueryCircle;
+
+// Cône d'une requête
+typedef struct {
+    float x, y;              // Sommet
+    float dir_x, dir_y;      // Axe normalisé
+    float cos_half;          // Cosinus du demi-angle d'ouverture
+    float radius_sq;         // Carré de la portée
+    Vector2 edges[2];        // Bords du cône, de longueur égale à la portée
+    bool full;               // Ouverture de 360° ou plus (simple disque)
+} QueryCone;
+
+// Point d'une boîte le plus proche d'une position
+static void closest_point_on_box(const BoundingBox* box, float x, float y, float* out_x, float* out_y) {
+    *out_x = x < box->x ? box->x : (x > box->x + box->width ? box->x + box->width : x);
+    *out_y = y < box->y ? box->y : (y > box->y + box->height ? box->y + box->height : y);
+}
+
+// Intersection d'un segment (origine + t * déplacement, t dans [0, 1]) avec une boîte
+// Renvoie la fraction d'entrée, négative si l'origine est dans la boîte, et la normale de la face d'entrée
+static bool segment_hits_box(float ox, float oy, float dx, float dy, const BoundingBox* box,
+                             float* t_enter, Vector2* normal) {
+    float enter = -INFINITY;
+    float exit = INFINITY;
+    Vector2 enter_normal = { 0.0f, 0.0f };
+    
+    const float origins[2] = { ox, oy };
+    const float deltas[2] = { dx, dy };
+    const float mins[2] = { box->x, box->y };
+    const float maxs[2] = { box->x + box->width, box->y + box->height };
+    
+    for (int axis = 0; axis < 2; axis++) {
+        if (deltas[axis] == 0.0f) {
+            // Parallèle aux faces de cet axe : l'origine doit être entre elles
+            if (origins[axis] < mins[axis] || origins[axis] > maxs[axis]) return false;
+            continue;
+        }
+        
+        float t_near = (mins[axis] - origins[axis]) / deltas[axis];
+        float t_far = (maxs[axis] - origins[axis]) / deltas[axis];
+        float side = -1.0f;
+        if (t_near > t_far) {
+            float t = t_near; t_near = t_far; t_far = t;
+            side = 1.0f;
+        }
+        
+        if (t_near > enter) {
+            enter = t_near;
+            enter_normal.x = axis == 0 ? side : 0.0f;
+            enter_normal.y = axis == 1 ? side : 0.0f;
+        }
+        if (t_far < exit) exit = t_far;
+    }
+    
+    if (enter > exit || exit < 0.0f || enter > 1.0f) {
+        return false;
+    }
+    
+    *t_enter = enter;
+    *normal = enter_normal;
+    return true;
+}
+
+// Chevauchement strict d'une boîte et d'un rectangle
+static bool rect_shape_test(const BoundingBox* box, const void* shape) {
+    return physics_check_box_collision(box, (const BoundingBox*)shape, NULL);
+}
+
+// Contact d'une boîte et d'un cercle (bord compris)
+static bool circle_shape_test(const BoundingBox* box, const void* shape) {
+    const QueryCircle* circle = (const QueryCircle*)shape;
+    
+    float px, py;
+    closest_point_on_box(box, circle->x, circle->y, &px, &py);
+    float vx = px - circle->x;
+    float vy = py - circle->y;
+    return vx * vx + vy * vy <= circle->radius_sq;
+}
+
+// Contact d'une boîte et d'un cône
+// Si la boîte touche le secteur sans que son point le plus proche du sommet y soit,
+// le segment qui relie ces deux points traverse un bord du cône : tester les bords suffit.
+static bool cone_shape_test(const BoundingBox* box, const void* shape) {
+    const QueryCone* cone = (const QueryCone*)shape;
+    
+    float px, py;
+    closest_point_on_box(box, cone->x, cone->y, &px, &py);
+    float vx = px - cone->x;
+    float vy = py - cone->y;
+    float distance_sq = vx * vx + vy * vy;
+    
+    if (distance_sq > cone->radius_sq) return false;
+    
+    // Sommet dans la boîte ou disque complet
+    if (cone->full || distance_sq == 0.0f) return true;
+    
+    if (vx * cone->dir_x + vy * cone->dir_y >= sqrtf(distance_sq) * cone->cos_half) return true;
+    
+    float t;
+    Vector2 normal;
+    return segment_hits_box(cone->x, cone->y, cone->edges[0].x, cone->edges[0].y, box, &t, &normal) ||
+           segment_hits_box(cone->x, cone->y, cone->edges[1].x, cone->edges[1].y, box, &t, &normal);
+}
+
+// Garde parmi les candidats de la phase large ceux dont la couche est acceptée et qui touchent la forme
+static int collect_shape_overlaps(
+    PhysicsSystem* system,
+    const BoundingBox* bounds,
+    uint32_t layer_mask,
+    QueryShapeTest test,
+    const void* shape,
+    EntityID* results,
+    int max_results
+) {
+    EntityManager* manager = system->entity_manager;
+    int candidate_count = gather_candidates(system, bounds);
+    
+    int count = 0;
+    for (int i = 0; i < candidate_count && count < max_results; i++) {
+        EntityID other_id = system->candidates[i];
+        
+        TransformComponent* transform;
+        ColliderComponent* collider;
+        if (!get_candidate_components(manager, other_id, &transform, &collider) ||
+            (collider->collision_layer & layer_mask) == 0) {
+            continue;
+        }
+        
+        BoundingBox box;
+        compute_bounds(transform, collider, &box);
+        if (test(&box, shape)) {
+            results[count++] = other_id;
+        }
+    }
+    
+    return count;
+}
+
+// Cherche les colliders qui chevauchent un rectangle
+int physics_query_rect(
+    PhysicsSystem* system,
+    const BoundingBox* rect,
+    uint32_t layer_mask,
+    EntityID* results,
+    int max_results
+) {
+    if (!system || !rect || !results || max_results <= 0) {
+        return 0;
+    }
+    
+    return collect_shape_overlaps(system, rect, layer_mask, rect_shape_test, rect, results, max_results);
+}
+
+// Cherche les colliders qui touchent un cercle
+int physics_query_circle(
+    PhysicsSystem* system,
+    float center_x,
+    float center_y,
+    float radius,
+    uint32_t layer_mask,
+    EntityID* results,
+    int max_results
+) {
+    if (!system || !results || max_results <= 0 || radius < 0.0f) {
+        return 0;
+    }
+    
+    QueryCircle circle = { center_x, center_y, radius * radius };
+    BoundingBox bounds = { center_x - radius, center_y - radius, radius * 2.0f, radius * 2.0f };
+    return collect_shape_overlaps(system, &bounds, layer_mask, circle_shape_test, &circle, results, max_results);
+}
+
+// Cherche les colliders qui touchent un cône
+int physics_query_cone(
+    PhysicsSystem* system,
+    float origin_x,
+    float origin_y,
+    float direction_x,
+    float direction_y,
+    float angle,
+    float radius,
+    uint32_t layer_mask,
+    EntityID* results,
+    int max_results
+) {
+    if (!system || !results || max_results <= 0 || radius < 0.0f || angle <= 0.0f) {
+        return 0;
+    }
+    
+    float length = sqrtf(direction_x * direction_x + direction_y * direction_y);
+    if (length <= 0.0f) {
+        return 0;
+    }
+    
+    QueryCone cone;
+    cone.x = origin_x;
+    cone.y = origin_y;
+    cone.dir_x = direction_x / length;
+    cone.dir_y = direction_y / length;
+    cone.radius_sq = radius * radius;
+    cone.full = angle >= 360.0f;
+    
+    float half_angle = angle * 0.5f * DEGREES_TO_RADIANS;
+    float cos_half = cosf(half_angle);
+    float sin_half = sinf(half_angle);
+    cone.cos_half = cos_half;
+    
+    // Axe tourné de +/- la demi-ouverture
+    cone.edges[0].x = (cone.dir_x * cos_half - cone.dir_y * sin_half) * radius;
+    cone.edges[0].y = (cone.dir_x * sin_half + cone.dir_y * cos_half) * radius;
+    cone.edges[1].x = (cone.dir_x * cos_half + cone.dir_y * sin_half) * radius;
+    cone.edges[1].y = (cone.dir_y * cos_half - cone.dir_x * sin_half) * radius;
+    
+    BoundingBox bounds = { origin_x - radius, origin_y - radius, radius * 2.0f, radius * 2.0f };
+    return collect_shape_overlaps(system, &bounds, layer_mask, cone_shape_test, &cone, results, max_results);
+}
+
+// Lance un rayon et renvoie le premier collider solide touché
+bool physics_raycast(
+    PhysicsSystem* system,
+    float origin_x,
+    float origin_y,
+    float direction_x,
+    float direction_y,
+    float max_distance,
+    uint32_t layer_mask,
+    RaycastHit* hit
+) {
+    if (!system || max_distance <= 0.0f) {
+        return false;
+    }
+    
+    float length = sqrtf(direction_x * direction_x + direction_y * direction_y);
+    if (length <= 0.0f) {
+        return false;
+    }
+    
+    float ray_x = direction_x / length * max_distance;
+    float ray_y = direction_y / length * max_distance;
+    BoundingBox bounds = {
+        ray_x < 0.0f ? origin_x + ray_x : origin_x,
+        ray_y < 0.0f ? origin_y + ray_y : origin_y,
+        fabsf(ray_x),
+        fabsf(ray_y)
+    };
+    
+    EntityManager* manager = system->entity_manager;
+    int candidate_count = gather_candidates(system, &bounds);
+    
+    float best_t = INFINITY;
+    Vector2 best_normal = { 0.0f, 0.0f };
+    EntityID best_entity = INVALID_ENTITY_ID;
+    
+    for (int i = 0; i < candidate_count; i++) {
+        EntityID other_id = system->candidates[i];
+        
+        TransformComponent* transform;
+        ColliderComponent* collider;
+        if (!get_candidate_components(manager, other_id, &transform, &collider) ||
+            collider->type == COLLISION_TRIGGER ||
+            (collider->collision_layer & layer_mask) == 0) {
+            continue;
+        }
+        
+        BoundingBox box;
+        compute_bounds(transform, collider, &box);
+        
+        float t;
+        Vector2 normal;
+        if (segment_hits_box(origin_x, origin_y, ray_x, ray_y, &box, &t, &normal) &&
+            t >= 0.0f && t < best_t) {
+            best_t = t;
+            best_normal = normal;
+            best_entity = other_id;
+        }
+    }
+    
+    if (best_entity == INVALID_ENTITY_ID) {
+        return false;
+    }
+    
+    if (hit) {
+        hit->entity = best_entity;
+        hit->point.x = origin_x + ray_x * best_t;
+        hit->point.y = origin_y + ray_y * best_t;
+        hit->normal = best_normal;
+        hit->distance = max_distance * best_t;
+    }
+    return true;
+}
+
+// Ajoute un obstacle au tampon du balayage
+static bool push_obstacle(PhysicsSystem* system, int count, const BoundingBox* box, EntityID entity_id) {
+    if (count >= system->obstacle_capacity) {
+        int new_capacity = system->obstacle_capacity ? system->obstacle_capacity * 2 : INITIAL_CANDIDATE_CAPACITY;
+        
+        BoundingBox* new_boxes = (BoundingBox*)realloc(system->obstacle_boxes, new_capacity * sizeof(BoundingBox));
+        if (!check_ptr(new_boxes, LOG_LEVEL_WARNING, "Échec d'agrandissement des obstacles du balayage")) {
+            return false;
+        }
+        system->obstacle_boxes = new_boxes;
+        
+        EntityID* new_entities = (EntityID*)realloc(system->obstacle_entities, new_capacity * sizeof(EntityID));
+        if (!check_ptr(new_entities, LOG_LEVEL_WARNING, "Échec d'agrandissement des obstacles du balayage")) {
+            return false;
+        }
+        system->obstacle_entities = new_entities;
+        system->obstacle_capacity = new_capacity;
+    }
+    
+    system->obstacle_boxes[count] = *box;
+    system->obstacle_entities[count] = entity_id;
+    return true;
+}
+
+// Rassemble en une seule requête les obstacles solides que peut toucher une boîte balayée
+static int collect_obstacles(
+    PhysicsSystem* system,
+    EntityID entity_id,
+    const ColliderComponent* collider,
+    const BoundingBox* swept
+) {
+    EntityManager* manager = system->entity_manager;
+    int count = 0;
+    
+    int candidate_count = gather_candidates(system, swept);
+    for (int i = 0; i < candidate_count; i++) {
+        EntityID other_id = system->candidates[i];
+        if (other_id == entity_id) continue;
+        
+        // Les triggers ne bloquent pas, les couches incompatibles non plus
+        TransformComponent* other_transform;
+        ColliderComponent* other_collider;
+        if (!get_candidate_components(manager, other_id, &other_transform, &other_collider) ||
+            other_collider->type == COLLISION_TRIGGER ||
+            (collider->collision_mask & other_collider->collision_layer) == 0) {
+            continue;
+        }
+        
+        BoundingBox other_box;
+        compute_bounds(other_transform, other_collider, &other_box);
+        if (push_obstacle(system, count, &other_box, other_id)) count++;
+    }
+    
+    // Tuiles non traversables couvertes par le balayage
+    const Map* map = system->tile_map;
+    if (map && map->tile_size > 0 && collider->type != COLLISION_TRIGGER) {
+        float tile_size = (float)map->tile_size;
+        int tile_min_x = (int)floorf(swept->x / tile_size);
+        int tile_min_y = (int)floorf(swept->y / tile_size);
+        int tile_max_x = (int)ceilf((swept->x + swept->width) / tile_size) - 1;
+        int tile_max_y = (int)ceilf((swept->y + swept->height) / tile_size) - 1;
+        
+        for (int ty = tile_min_y; ty <= tile_max_y; ty++) {
+            for (int tx = tile_min_x; tx <= tile_max_x; tx++) {
+                if (world_map_is_tile_walkable(map, tx, ty)) continue;
+                
+                BoundingBox tile_box = { tx * tile_size, ty * tile_size, tile_size, tile_size };
+                if (push_obstacle(system, count, &tile_box, INVALID_ENTITY_ID)) count++;
+            }
+        }
+    }
+    
+    return count;
+}
+
+// Calcule l'instant d'impact d'une boîte en mouvement contre un obstacle immobile
+// Renvoie une fraction dans [0, 1[ ou 1 si le déplacement n'atteint pas l'obstacle.
+// Un obstacle déjà chevauché au départ est ignoré pour permettre d'en sortir.
+static float sweep_box(const BoundingBox* box, float dx, float dy, const BoundingBox* obstacle, Vector2* normal) {
+    float entry_x, exit_x, entry_y, exit_y;
+    
+    if (dx > 0.0f) {
+        entry_x = (obstacle->x - (box->x + box->width)) / dx;
+        exit_x = (obstacle->x + obstacle->width - box->x) / dx;
+    } else if (dx < 0.0f) {
+        entry_x = (obstacle->x + obstacle->width - box->x) / dx;
+        exit_x = (obstacle->x - (box->x + box->width)) / dx;
+    } else {
+        if (box->x + box->width <= obstacle->x || box->x >= obstacle->x + obstacle->width) return 1.0f;
+        entry_x = -INFINITY;
+        exit_x = INFINITY;
+    }
+    
+    if (dy > 0.0f) {
+        entry_y = (obstacle->y - (box->y + box->height)) / dy;
+        exit_y = (obstacle->y + obstacle->height - box->y) / dy;
+    } else if (dy < 0.0f) {
+        entry_y = (obstacle->y + obstacle->height - box->y) / dy;
+        exit_y = (obstacle->y - (box->y + box->height)) / dy;
+    } else {
+        if (box->y + box->height <= obstacle->y || box->y >= obstacle->y + obstacle->height) return 1.0f;
+        entry_y = -INFINITY;
+        exit_y = INFINITY;
+    }
+    
+    float entry = entry_x > entry_y ? entry_x : entry_y;
+    float exit = exit_x < exit_y ? exit_x : exit_y;
+    
+    // Pas de chevauchement strict pendant le déplacement (un frôlement d'angle ne bloque pas)
+    if (entry >= exit || entry < 0.0f || entry >= 1.0f) {
+        return 1.0f;
+    }
+    
+    if (entry_x > entry_y) {
+        normal->x = dx > 0.0f ? -1.0f : 1.0f;
+        normal->y = 0.0f;
+    } else {
+        normal->x = 0.0f;
+        normal->y = dy > 0.0f ? -1.0f : 1.0f;
+    }
+    return entry;
+}
+
+// Premier impact d'une boîte en mouvement parmi les obstacles rassemblés
+// Renvoie la fraction du déplacement à appliquer, en s'arrêtant juste avant la surface touchée
+static float sweep_obstacles(
+    PhysicsSystem* system,
+    int obstacle_count,
+    const BoundingBox* box,
+    float dx,
+    float dy,
+    Vector2* normal,
+    EntityID* hit_entity
+) {
+    float time_of_impact = 1.0f;
+    normal->x = 0.0f;
+    normal->y = 0.0f;
+    *hit_entity = INVALID_ENTITY_ID;
+    
+    for (int i = 0; i < obstacle_count; i++) {
+        Vector2 obstacle_normal;
+        float t = sweep_box(box, dx, dy, &system->obstacle_boxes[i], &obstacle_normal);
+        if (t < time_of_impact) {
+            time_of_impact = t;
+            *normal = obstacle_normal;
+            *hit_entity = system->obstacle_entities[i];
+        }
+    }
+    
+    // Garder un léger écart : arrondi compris, la boîte ne doit jamais entrer dans l'obstacle
+    if (time_of_impact < 1.0f) {
+        float length = sqrtf(dx * dx + dy * dy);
+        time_of_impact -= PHYSICS_CONTACT_SKIN / length;
+        if (time_of_impact < 0.0f) time_of_impact = 0.0f;
+    }
+    return time_of_impact;
+}
+
 // Déplace une entité en tenant compte des collisions
-bool physics_move_entity(PhysicsSystem* system, EntityID entity_id, float dx, float dy) {
+bool physics_move_entity(PhysicsSystem* system, EntityID entity_id, float dx, float dy, MoveResult* result) {
     if (!system || entity_id == INVALID_ENTITY_ID) {
         return false;
     }
     
+    MoveResult move = { { 0.0f, 0.0f }, { 0.0f, 0.0f }, { 0.0f, 0.0f }, 1.0f, INVALID_ENTITY_ID };
+    
     // Récupérer les composants nécessaires
     TransformComponent* transform = (TransformComponent*)entity_get_component(
         system->entity_manager, entity_id, COMPONENT_TRANSFORM
@@ -278,23 +1078,112 @@ bool physics_move_entity(PhysicsSystem* system, EntityID entity_id, float dx, fl
         return false;
     }
     
-    // Calculer la nouvelle position
-    float new_x = transform->x + dx;
-    float new_y = transform->y + dy;
+    ColliderComponent* collider = (ColliderComponent*)entity_get_component(
+        system->entity_manager, entity_id, COMPONENT_COLLIDER
+    );
     
-    // Essayer d'abord de déplacer horizontalement
-    if (physics_is_position_valid(system, entity_id, new_x, transform->y, INVALID_ENTITY_ID)) {
-        transform->x = new_x;
+    if (!collider) {
+        // Sans collider, l'entité ne peut rien heurter
+        move.moved.x = dx;
+        move.moved.y = dy;
+    } else if (dx != 0.0f || dy != 0.0f) {
+        BoundingBox box;
+        compute_bounds(transform, collider, &box);
+        
+        // Une seule requête couvre le trajet complet ; le glissement reste dans cette zone
+        BoundingBox swept = {
+            dx < 0.0f ? box.x + dx : box.x,
+            dy < 0.0f ? box.y + dy : box.y,
+            box.width + fabsf(dx),
+            box.height + fabsf(dy)
+        };
+        int obstacle_count = collect_obstacles(system, entity_id, collider, &swept);
+        
+        // Avancer jusqu'au premier impact
+        move.time_of_impact = sweep_obstacles(system, obstacle_count, &box, dx, dy, &move.normal, &move.entity);
+        move.moved.x = dx * move.time_of_impact;
+        move.moved.y = dy * move.time_of_impact;
+        
+        // Puis glisser le long de la surface touchée avec le reste du déplacement
+        if (move.time_of_impact < 1.0f) {
+            float remaining = 1.0f - move.time_of_impact;
+            float slide_x = move.normal.x != 0.0f ? 0.0f : dx * remaining;
+            float slide_y = move.normal.y != 0.0f ? 0.0f : dy * remaining;
+            
+            if (slide_x != 0.0f || slide_y != 0.0f) {
+                box.x += move.moved.x;
+                box.y += move.moved.y;
+                
+                Vector2 slide_normal;
+                EntityID slide_entity;
+                float slide_time = sweep_obstacles(system, obstacle_count, &box, slide_x, slide_y,
+                                                   &slide_normal, &slide_entity);
+                move.slide.x = slide_x * slide_time;
+                move.slide.y = slide_y * slide_time;
+                move.moved.x += move.slide.x;
+                move.moved.y += move.slide.y;
+            }
+        }
     }
     
-    // Puis essayer de déplacer verticalement
-    if (physics_is_position_valid(system, entity_id, transform->x, new_y, INVALID_ENTITY_ID)) {
-        transform->y = new_y;
+    transform->x += move.moved.x;
+    transform->y += move.moved.y;
+    
+    // Signaler le déplacement aux consommateurs de changements et à la phase large
+    if (move.moved.x != 0.0f || move.moved.y != 0.0f) {
+        entity_mark_changed(system->entity_manager, entity_id, COMPONENT_TRANSFORM);
+        if (collider) {
+            broadphase_update_entity(system, entity_id, transform, collider);
+        }
     }
     
+    if (result) *result = move;
     return true;
 }
 
+// Signale au cache les colliders dynamiques présents dans chaque déclencheur
+static void update_trigger_contacts(PhysicsSystem* system) {
+    EntityManager* manager = system->entity_manager;
+    ContactCache* contacts = system->trigger_contacts;
+    
+    contact_cache_begin_frame(contacts);
+    
+    const EntityID* entities = system->trigger_query->entities;
+    for (int i = 0; i < system->trigger_query->count; i++) {
+        EntityID trigger_id = entities[i];
+        ColliderComponent* trigger = (ColliderComponent*)entity_get_component(
+            manager, trigger_id, COMPONENT_COLLIDER
+        );
+        if (!trigger || trigger->type != COLLISION_TRIGGER) continue;
+        
+        BoundingBox trigger_box;
+        if (!physics_get_entity_bounds(system, trigger_id, &trigger_box)) continue;
+        
+        int candidate_count = gather_candidates(system, &trigger_box);
+        for (int j = 0; j < candidate_count; j++) {
+            EntityID other_id = system->candidates[j];
+            if (other_id == trigger_id) continue;
+            
+            TransformComponent* other_transform;
+            ColliderComponent* other;
+            if (!get_candidate_components(manager, other_id, &other_transform, &other) ||
+                other->type != COLLISION_DYNAMIC ||
+                (trigger->collision_mask & other->collision_layer) == 0) {
+                continue;
+            }
+            
+            BoundingBox other_box;
+            compute_bounds(other_transform, other, &other_box);
+            if (physics_check_box_collision(&trigger_box, &other_box, NULL)) {
+                contact_cache_report(contacts, trigger_id, other_id);
+            }
+        }
+    }
+    
+    // Les contacts non signalés (sortie, destruction, retrait du collider) émettent leur sortie
+    contact_cache_end_frame(contacts);
+}
+
 // Met à jour le système de physique
 void physics_system_update(PhysicsSystem* system, float delta_time) {
     if (!system) return;
@@ -302,64 +1191,71 @@ void physics_system_update(PhysicsSystem* system, float delta_time) {
     // Réinitialiser les résultats de collision
     system->collision_results_count = 0;
     
+    // Tenir la phase large à jour des ajouts, retraits et déplacements externes
+    broadphase_sync(system);
+    
+    // Paires de colliders dynamiques, mises à jour depuis celles de l'image précédente
+    sweep_and_prune_update(system->dynamic_pairs);
+    
+    // Entrées, maintiens et sorties des déclencheurs, comparés à l'image précédente
+    update_trigger_contacts(system);
+    
     // Cette fonction pourrait être étendue pour effectuer d'autres mises à jour
     // comme la simulation de la physique, la gravité, etc.
 }
 
+// Renvoie les paires de colliders dynamiques qui se chevauchent
+int physics_get_dynamic_pairs(PhysicsSystem* system, const SweepOverlap** pairs) {
+    if (!system || !pairs) return 0;
+    
+    *pairs = system->dynamic_pairs->overlaps;
+    return system->dynamic_pairs->overlap_count;
+}
+
+// Renvoie les événements de déclencheur d'un type émis par la dernière mise à jour
+int physics_get_trigger_events(PhysicsSystem* system, ContactEventType type, const ContactPair** events) {
+    if (!system || !events) return 0;
+    
+    return contact_cache_get_events(system->trigger_contacts, type, events);
+}
+
 // Affiche les hitboxes pour le débogage
 void physics_system_debug_render(PhysicsSystem* system, RenderSystem* render_system) {
     if (!system || !render_system || !system->debug_draw) return;
     
-    // Créer un masque de requête pour trouver les entités avec un collider
-    ComponentMask query_mask = COMPONENT_BIT(COMPONENT_TRANSFORM) | COMPONENT_BIT(COMPONENT_COLLIDER);
+    EntityManager* manager = system->entity_manager;
+    BoundingBox box;
     
-    // Tableau pour stocker les entités trouvées
-    EntityID entities[1024];
-    int entity_count = entity_find_with_components(
-        system->entity_manager, query_mask, entities, 1024
-    );
+    // En stockage par archétypes, lire les colonnes des chunks sans recherche par entité
+    if (manager->storage_mode == ENTITY_STORAGE_ARCHETYPES) {
+        ArchetypeChunkIterator it;
+        ArchetypeChunkView view;
+        entity_chunk_iter_begin(manager, system->collider_query->mask, &it);
+        
+        while (entity_chunk_iter_next(manager, &it, &view)) {
+            const TransformComponent* transforms = (const TransformComponent*)view.columns[COMPONENT_TRANSFORM];
+            const ColliderComponent* colliders = (const ColliderComponent*)view.columns[COMPONENT_COLLIDER];
+            
+            for (int i = 0; i < view.count; i++) {
+                compute_bounds(&transforms[i], &colliders[i], &box);
+                draw_collider_box(render_system, &box, &colliders[i]);
+            }
+        }
+        return;
+    }
+    
+    // Sinon, parcourir directement la vue des entités possédant un collider
+    const EntityID* entities = system->collider_query->entities;
+    int entity_count = system->collider_query->count;
     
     // Dessiner les boîtes englobantes de chaque entité
     for (int i = 0; i < entity_count; i++) {
-        EntityID entity_id = entities[i];
+        ColliderComponent* collider = (ColliderComponent*)entity_get_component(
+            manager, entities[i], COMPONENT_COLLIDER
+        );
         
-        // Récupérer la boîte englobante
-        BoundingBox box;
-        if (physics_get_entity_bounds(system, entity_id, &box)) {
-            // Récupérer le type de collision pour choisir la couleur
-            ColliderComponent* collider = (ColliderComponent*)entity_get_component(
-                system->entity_manager, entity_id, COMPONENT_COLLIDER
-            );
-            
-            if (!collider) continue;
-            
-            // Choisir la couleur selon le type de collision
-            uint8_t r = 0, g = 0, b = 0, a = 255;
-            switch (collider->type) {
-                case COLLISION_STATIC:
-                    r = 255; g = 0; b = 0;  // Rouge pour les objets statiques
-                    break;
-                case COLLISION_DYNAMIC:
-                    r = 0; g = 255; b = 0;  // Vert pour les objets dynamiques
-                    break;
-                case COLLISION_TRIGGER:
-                    r = 0; g = 0; b = 255;  // Bleu pour les triggers
-                    break;
-                default:
-                    r = 255; g = 255; b = 0;  // Jaune pour les autres
-                    break;
-            }
-            
-            // Dessiner la boîte englobante
-            render_system_draw_rect(
-                render_system,
-                box.x + box.width / 2.0f,  // Centrer sur la position
-                box.y + box.height / 2.0f,
-                box.width,
-                box.height,
-                r, g, b, a,
-                false  // Non rempli
-            );
+        if (collider && physics_get_entity_bounds(system, entities[i], &box)) {
+            draw_collider_box(render_system, &box, collider);
         }
     }
 }
\ No newline at end of file
@@ -9,6 +9,11 @@
 #include <stdbool.h>
 #include "../core/entity.h"
 #include "../systems/entity_manager.h"
+#include "../systems/spatial_hash.h"
+#include "../systems/aabb_tree.h"
+#include "../systems/sweep_and_prune.h"
+#include "../systems/contact_cache.h"
+#include "../systems/world.h"
 
 // Représente une position dans l'espace
 typedef struct {
@@ -29,13 +34,48 @@ typedef struct {
     CollisionType type;      // Type de collision
 } CollisionResult;
 
+// Résultat d'un déplacement balayé
+typedef struct {
+    Vector2 moved;           // Déplacement effectivement appliqué (glissement compris)
+    Vector2 slide;           // Glissement appliqué le long de la surface touchée après l'impact
+    Vector2 normal;          // Normale de la surface touchée (nulle sans impact)
+    float time_of_impact;    // Fraction du déplacement demandé parcourue avant l'impact (1 sans impact)
+    EntityID entity;         // Entité touchée (INVALID_ENTITY_ID pour une tuile ou sans impact)
+} MoveResult;
+
+// Résultat d'un lancer de rayon
+typedef struct {
+    EntityID entity;         // Entité touchée
+    Vector2 point;           // Point d'impact
+    Vector2 normal;          // Normale de la face touchée
+    float distance;          // Distance parcourue depuis l'origine jusqu'à l'impact
+} RaycastHit;
+
 // Système de physique
 typedef struct {
     EntityManager* entity_manager;         // Gestionnaire d'entités
+    EntityQuery* collider_query;           // Vue des entités Transform + Collider
+    EntityQuery* trigger_query;            // Vue des déclencheurs (Transform + Collider + COMPONENT_TAG_TRIGGER)
     CollisionResult* collision_results;    // Résultats de collision
     int max_collision_results;             // Nombre maximum de résultats de collision
     int collision_results_count;           // Nombre actuel de résultats de collision
     bool debug_draw;                       // Afficher les boîtes de collision
+
+    // Phase large : grille hachée des colliders mobiles, arbre des colliders statiques
+    SpatialHash* broadphase;               // Boîtes mobiles indexées par cellule
+    AabbTree* static_tree;                 // Boîtes des colliders COLLISION_STATIC
+    SweepAndPrune* dynamic_pairs;          // Paires chevauchantes entre colliders COLLISION_DYNAMIC
+    ContactCache* trigger_contacts;        // Contacts (déclencheur, collider dynamique) d'une image à l'autre
+
+    const Map* tile_map;                   // Carte dont les tuiles non traversables bloquent (NULL si aucune)
+    uint32_t broadphase_tick;              // Tick du gestionnaire à la dernière synchronisation
+    EntityID* candidates;                  // Tampon des candidats renvoyés par la grille
+    EntityID* changed;                     // Tampon des entités modifiées depuis la dernière synchronisation
+    int changed_capacity;                  // Taille du tampon des entités modifiées
+    int candidate_capacity;                // Taille du tampon des candidats
+    BoundingBox* obstacle_boxes;           // Obstacles du déplacement en cours (colliders et tuiles)
+    EntityID* obstacle_entities;           // Entité de chaque obstacle (INVALID_ENTITY_ID pour une tuile)
+    int obstacle_capacity;                 // Taille des tampons d'obstacles
 } PhysicsSystem;
 
 /**
@@ -51,8 +91,22 @@ PhysicsSystem* physics_system_init(EntityManager* entity_manager);
  */
 void physics_system_shutdown(PhysicsSystem* system);
 
+/**
+ * Définit la carte dont les tuiles non traversables bloquent les déplacements
+ * Les tests utilisent les bits de traversabilité des chunks : ceux-ci doivent être
+ * reconstruits au chargement et tenus à jour à chaque modification de tuile.
+ * @param system Système de physique
+ * @param map Carte courante (NULL pour ignorer les tuiles)
+ */
+void physics_system_set_tile_map(PhysicsSystem* system, const Map* map);
+
 /**
  * Met à jour le système de physique
+ * Synchronise la phase large : les colliders ajoutés, retirés ou dont le Transform
+ * a été marqué modifié depuis la mise à jour précédente y sont répercutés.
+ * Les déplacements faits par physics_move_entity y sont répercutés immédiatement.
+ * Recalcule ensuite les paires de colliders dynamiques qui se chevauchent
+ * et les événements d'entrée, de maintien et de sortie des déclencheurs.
  * @param system Système de physique
  * @param delta_time Temps écoulé depuis la dernière mise à jour en secondes
  */
@@ -65,6 +119,30 @@ void physics_system_update(PhysicsSystem* system, float delta_time);
  */
 void physics_system_debug_render(PhysicsSystem* system, RenderSystem* render_system);
 
+/**
+ * Renvoie les paires de colliders dynamiques qui se chevauchent
+ * Les paires sont celles calculées par le dernier physics_system_update ;
+ * le tableau reste valide jusqu'au suivant.
+ * @param system Système de physique
+ * @param pairs Pointeur à remplir avec le tableau des paires
+ * @return Nombre de paires
+ */
+int physics_get_dynamic_pairs(PhysicsSystem* system, const SweepOverlap** pairs);
+
+/**
+ * Renvoie les événements de déclencheur d'un type émis par le dernier physics_system_update
+ * Chaque paire associe un collider COLLISION_TRIGGER (a) à un collider COLLISION_DYNAMIC (b)
+ * dont la couche est dans le masque du déclencheur. Seuls les déclencheurs portant le tag
+ * COMPONENT_TAG_TRIGGER sont suivis. Une sortie est aussi émise quand l'une
+ * des deux entités est détruite ou perd son collider. Le tableau reste valide jusqu'à la
+ * mise à jour suivante.
+ * @param system Système de physique
+ * @param type CONTACT_ENTER, CONTACT_STAY ou CONTACT_EXIT
+ * @param events Pointeur à remplir avec le tableau des événements
+ * @return Nombre d'événements
+ */
+int physics_get_trigger_events(PhysicsSystem* system, ContactEventType type, const ContactPair** events);
+
 /**
  * Vérifie si une entité est en collision avec d'autres entités
  * @param system Système de physique
@@ -82,6 +160,8 @@ int physics_check_entity_collisions(
 
 /**
  * Vérifie si une position est valide pour une entité (sans collision)
+ * La position est invalide si la boîte chevauche une tuile non traversable de la carte
+ * ou le collider solide d'une autre entité.
  * @param system Système de physique
  * @param entity_id ID de l'entité
  * @param x Position X à vérifier
@@ -99,13 +179,19 @@ bool physics_is_position_valid(
 
 /**
  * Déplace une entité en tenant compte des collisions
+ * La boîte est balayée le long du déplacement : elle s'arrête au premier impact contre
+ * un collider solide ou une tuile non traversable (sans traverser les obstacles minces,
+ * quelle que soit la vitesse), puis glisse le long de la surface avec le reste du
+ * déplacement. Les obstacles sont rassemblés par une seule requête de la phase large.
+ * Un obstacle déjà chevauché au départ ne bloque pas, pour permettre d'en sortir.
  * @param system Système de physique
  * @param entity_id ID de l'entité
  * @param dx Déplacement en X
  * @param dy Déplacement en Y
+ * @param result Détail du déplacement et de l'impact (peut être NULL)
  * @return true si le déplacement a été effectué, false sinon
  */
-bool physics_move_entity(PhysicsSystem* system, EntityID entity_id, float dx, float dy);
+bool physics_move_entity(PhysicsSystem* system, EntityID entity_id, float dx, float dy, MoveResult* result);
 
 /**
  * Calcule la boîte englobante d'une entité
@@ -116,6 +202,97 @@ bool physics_move_entity(PhysicsSystem* system, EntityID entity_id, float dx, fl
  */
 bool physics_get_entity_bounds(PhysicsSystem* system, EntityID entity_id, BoundingBox* box);
 
+/**
+ * Cherche les colliders qui chevauchent un rectangle
+ * Comme les requêtes suivantes, ne visite que les candidats de la phase large, garde
+ * les colliders dont la couche est dans layer_mask et n'alloue rien par appel.
+ * @param system Système de physique
+ * @param rect Rectangle de la requête
+ * @param layer_mask Couches de collision acceptées
+ * @param results Tableau à remplir avec les entités trouvées
+ * @param max_results Taille du tableau de résultats
+ * @return Nombre d'entités écrites dans results
+ */
+int physics_query_rect(
+    PhysicsSystem* system,
+    const BoundingBox* rect,
+    uint32_t layer_mask,
+    EntityID* results,
+    int max_results
+);
+
+/**
+ * Cherche les colliders qui touchent un cercle (ex: rayon d'interaction, zone circulaire)
+ * @param system Système de physique
+ * @param center_x Centre X du cercle
+ * @param center_y Centre Y du cercle
+ * @param radius Rayon du cercle
+ * @param layer_mask Couches de collision acceptées
+ * @param results Tableau à remplir avec les entités trouvées
+ * @param max_results Taille du tableau de résultats
+ * @return Nombre d'entités écrites dans results
+ */
+int physics_query_circle(
+    PhysicsSystem* system,
+    float center_x,
+    float center_y,
+    float radius,
+    uint32_t layer_mask,
+    EntityID* results,
+    int max_results
+);
+
+/**
+ * Cherche les colliders qui touchent un cône (secteur de disque, ex: zone d'effet d'un outil)
+ * @param system Système de physique
+ * @param origin_x Sommet X du cône
+ * @param origin_y Sommet Y du cône
+ * @param direction_x Direction X de l'axe du cône (non nécessairement normalisée)
+ * @param direction_y Direction Y de l'axe du cône
+ * @param angle Ouverture totale du cône en degrés (360 ou plus pour un disque)
+ * @param radius Portée du cône
+ * @param layer_mask Couches de collision acceptées
+ * @param results Tableau à remplir avec les entités trouvées
+ * @param max_results Taille du tableau de résultats
+ * @return Nombre d'entités écrites dans results
+ */
+int physics_query_cone(
+    PhysicsSystem* system,
+    float origin_x,
+    float origin_y,
+    float direction_x,
+    float direction_y,
+    float angle,
+    float radius,
+    uint32_t layer_mask,
+    EntityID* results,
+    int max_results
+);
+
+/**
+ * Lance un rayon et renvoie le premier collider solide touché
+ * Les triggers et les colliders qui contiennent l'origine (ex: celui du lanceur) sont ignorés.
+ * @param system Système de physique
+ * @param origin_x Origine X du rayon
+ * @param origin_y Origine Y du rayon
+ * @param direction_x Direction X du rayon (non nécessairement normalisée)
+ * @param direction_y Direction Y du rayon
+ * @param max_distance Longueur du rayon
+ * @param layer_mask Couches de collision acceptées
+ * @param hit Impact à remplir (peut être NULL)
+ * @return true si un collider est touché, false sinon
+ */
+bool physics_raycast(
+    PhysicsSystem* system,
+    float origin_x,
+    float origin_y,
+    float direction_x,
+    float direction_y,
+    float max_distance,
+    uint32_t layer_mask,
+    RaycastHit* hit
+);
+
 /**
  * Vérifie si deux boîtes englobantes se chevauchent
  * @param a Première boîte
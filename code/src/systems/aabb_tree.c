@@ -0,0 +1,424 @@
+/**
+ * aabb_tree.c
+ * Implémentation de l'arbre de boîtes englobantes
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../systems/aabb_tree.h"
+#include "../utils/error_handler.h"
+
+// Capacité initiale du tableau sparse
+#define INITIAL_SPARSE_CAPACITY 1024
+
+// Capacité initiale du tableau de nœuds
+#define INITIAL_NODE_CAPACITY 64
+
+// Marge de profondeur tolérée au-delà de 2 * log2(feuilles) avant reconstruction
+#define AABB_TREE_HEIGHT_SLACK 4
+
+// Feuille à trier lors de la reconstruction
+typedef struct {
+    float center;   // Centre de la boîte sur l'axe de découpe
+    int node;       // Feuille correspondante
+} SortedLeaf;
+
+// Boîte englobant deux nœuds
+static inline void merge_boxes(const AabbTreeNode* a, const AabbTreeNode* b, AabbTreeNode* out) {
+    out->min_x = a->min_x < b->min_x ? a->min_x : b->min_x;
+    out->min_y = a->min_y < b->min_y ? a->min_y : b->min_y;
+    out->max_x = a->max_x > b->max_x ? a->max_x : b->max_x;
+    out->max_y = a->max_y > b->max_y ? a->max_y : b->max_y;
+}
+
+// Périmètre d'une boîte (coût d'un nœud pour l'heuristique d'insertion)
+static inline float perimeter(const AabbTreeNode* node) {
+    return 2.0f * ((node->max_x - node->min_x) + (node->max_y - node->min_y));
+}
+
+// Garantit que l'index sparse couvre un index d'entité
+static bool ensure_sparse(AabbTree* tree, uint32_t index) {
+    if (index < tree->sparse_capacity) return true;
+
+    uint32_t new_capacity = tree->sparse_capacity ? tree->sparse_capacity : INITIAL_SPARSE_CAPACITY;
+    while (new_capacity <= index) {
+        new_capacity *= 2;
+    }
+
+    int* new_sparse = (int*)realloc(tree->sparse, new_capacity * sizeof(int));
+    if (!check_ptr(new_sparse, LOG_LEVEL_ERROR, "Échec d'agrandissement de l'index de l'arbre")) {
+        return false;
+    }
+
+    for (uint32_t i = tree->sparse_capacity; i < new_capacity; i++) {
+        new_sparse[i] = -1;
+    }
+    tree->sparse = new_sparse;
+    tree->sparse_capacity = new_capacity;
+    return true;
+}
+
+// Garantit que la pile de parcours couvre la hauteur de l'arbre (les requêtes n'allouent rien)
+static bool ensure_stack(AabbTree* tree) {
+    int required = (tree->root >= 0 ? tree->nodes[tree->root].height : 0) + 2;
+    if (required <= tree->stack_capacity) return true;
+
+    int new_capacity = tree->stack_capacity ? tree->stack_capacity : 32;
+    while (new_capacity < required) {
+        new_capacity *= 2;
+    }
+
+    int* new_stack = (int*)realloc(tree->stack, new_capacity * sizeof(int));
+    if (!check_ptr(new_stack, LOG_LEVEL_ERROR, "Échec d'agrandissement de la pile de l'arbre")) {
+        return false;
+    }
+    tree->stack = new_stack;
+    tree->stack_capacity = new_capacity;
+    return true;
+}
+
+// Trouve la feuille d'une entité
+static int find_leaf(const AabbTree* tree, EntityID entity_id) {
+    if (!tree || entity_id == INVALID_ENTITY_ID) return -1;
+
+    uint32_t index = ENTITY_INDEX(entity_id);
+    if (index >= tree->sparse_capacity) return -1;
+
+    int leaf = tree->sparse[index];
+    if (leaf < 0 || tree->nodes[leaf].entity != entity_id) return -1;
+    return leaf;
+}
+
+// Prend un nœud dans la liste libre ou en fin de tableau
+static int allocate_node(AabbTree* tree) {
+    int node;
+    if (tree->free_node >= 0) {
+        node = tree->free_node;
+        tree->free_node = tree->nodes[node].parent;
+    } else {
+        if (tree->node_count >= tree->node_capacity) {
+            int new_capacity = tree->node_capacity ? tree->node_capacity * 2 : INITIAL_NODE_CAPACITY;
+            AabbTreeNode* new_nodes = (AabbTreeNode*)realloc(tree->nodes, new_capacity * sizeof(AabbTreeNode));
+            if (!check_ptr(new_nodes, LOG_LEVEL_ERROR, "Échec d'agrandissement des nœuds de l'arbre")) {
+                return -1;
+            }
+            tree->nodes = new_nodes;
+            tree->node_capacity = new_capacity;
+        }
+        node = tree->node_count++;
+    }
+
+    tree->nodes[node].entity = INVALID_ENTITY_ID;
+    tree->nodes[node].parent = -1;
+    tree->nodes[node].left = -1;
+    tree->nodes[node].right = -1;
+    tree->nodes[node].height = 0;
+    return node;
+}
+
+// Rend un nœud à la liste libre
+static void free_node(AabbTree* tree, int node) {
+    tree->nodes[node].height = -1;
+    tree->nodes[node].parent = tree->free_node;
+    tree->free_node = node;
+}
+
+// Recalcule boîtes et hauteurs d'un nœud jusqu'à la racine
+static void refit_upward(AabbTree* tree, int node) {
+    while (node >= 0) {
+        AabbTreeNode* current = &tree->nodes[node];
+        const AabbTreeNode* left = &tree->nodes[current->left];
+        const AabbTreeNode* right = &tree->nodes[current->right];
+
+        merge_boxes(left, right, current);
+        current->height = 1 + (left->height > right->height ? left->height : right->height);
+        node = current->parent;
+    }
+}
+
+// Coût d'une descente vers un enfant pour l'heuristique d'insertion
+static float descend_cost(const AabbTree* tree, int child, const AabbTreeNode* leaf, float inheritance) {
+    AabbTreeNode merged;
+    merge_boxes(&tree->nodes[child], leaf, &merged);
+
+    if (tree->nodes[child].height == 0) {
+        return perimeter(&merged) + inheritance;
+    }
+    return perimeter(&merged) - perimeter(&tree->nodes[child]) + inheritance;
+}
+
+// Accroche une feuille à côté du nœud qui augmente le moins le périmètre total
+static bool insert_leaf(AabbTree* tree, int leaf) {
+    if (tree->root < 0) {
+        tree->root = leaf;
+        tree->nodes[leaf].parent = -1;
+        return true;
+    }
+
+    // Descendre tant qu'un enfant coûte moins cher qu'un frère direct
+    const AabbTreeNode* leaf_node = &tree->nodes[leaf];
+    int index = tree->root;
+    while (tree->nodes[index].height > 0) {
+        AabbTreeNode merged;
+        merge_boxes(&tree->nodes[index], leaf_node, &merged);
+
+        float sibling_cost = 2.0f * perimeter(&merged);
+        float inheritance = 2.0f * (perimeter(&merged) - perimeter(&tree->nodes[index]));
+        float left_cost = descend_cost(tree, tree->nodes[index].left, leaf_node, inheritance);
+        float right_cost = descend_cost(tree, tree->nodes[index].right, leaf_node, inheritance);
+
+        if (sibling_cost < left_cost && sibling_cost < right_cost) break;
+        index = left_cost < right_cost ? tree->nodes[index].left : tree->nodes[index].right;
+    }
+
+    // Nouveau parent commun à la feuille et à son frère
+    int parent = allocate_node(tree);
+    if (parent < 0) return false;
+
+    int sibling = index;
+    int old_parent = tree->nodes[sibling].parent;
+    tree->nodes[parent].parent = old_parent;
+    tree->nodes[parent].left = sibling;
+    tree->nodes[parent].right = leaf;
+    tree->nodes[sibling].parent = parent;
+    tree->nodes[leaf].parent = parent;
+
+    if (old_parent < 0) {
+        tree->root = parent;
+    } else if (tree->nodes[old_parent].left == sibling) {
+        tree->nodes[old_parent].left = parent;
+    } else {
+        tree->nodes[old_parent].right = parent;
+    }
+
+    refit_upward(tree, parent);
+    return true;
+}
+
+// Décroche une feuille : son frère prend la place de leur parent
+static void remove_leaf(AabbTree* tree, int leaf) {
+    if (leaf == tree->root) {
+        tree->root = -1;
+        return;
+    }
+
+    int parent = tree->nodes[leaf].parent;
+    int grand_parent = tree->nodes[parent].parent;
+    int sibling = tree->nodes[parent].left == leaf ? tree->nodes[parent].right : tree->nodes[parent].left;
+
+    tree->nodes[sibling].parent = grand_parent;
+    if (grand_parent < 0) {
+        tree->root = sibling;
+    } else {
+        if (tree->nodes[grand_parent].left == parent) {
+            tree->nodes[grand_parent].left = sibling;
+        } else {
+            tree->nodes[grand_parent].right = sibling;
+        }
+        refit_upward(tree, grand_parent);
+    }
+    free_node(tree, parent);
+}
+
+// Retire une feuille de l'arbre et de l'index
+static void drop_leaf(AabbTree* tree, int leaf) {
+    tree->sparse[ENTITY_INDEX(tree->nodes[leaf].entity)] = -1;
+    remove_leaf(tree, leaf);
+    free_node(tree, leaf);
+    tree->leaf_count--;
+}
+
+// Hauteur au-delà de laquelle l'arbre est reconstruit
+static int height_limit(int leaf_count) {
+    int log2 = 0;
+    while ((1 << log2) < leaf_count) {
+        log2++;
+    }
+    return 2 * log2 + AABB_TREE_HEIGHT_SLACK;
+}
+
+// Tri des feuilles selon leur centre
+static int compare_sorted_leaves(const void* a, const void* b) {
+    float ca = ((const SortedLeaf*)a)->center;
+    float cb = ((const SortedLeaf*)b)->center;
+    return (ca > cb) - (ca < cb);
+}
+
+// Construit récursivement un sous-arbre équilibré à partir de feuilles
+static int build_range(AabbTree* tree, SortedLeaf* leaves, int count) {
+    if (count == 1) return leaves[0].node;
+
+    // Découper selon l'axe où les centres sont le plus étalés
+    float min_cx = 0.0f, max_cx = 0.0f, min_cy = 0.0f, max_cy = 0.0f;
+    for (int i = 0; i < count; i++) {
+        const AabbTreeNode* node = &tree->nodes[leaves[i].node];
+        float cx = node->min_x + node->max_x;
+        float cy = node->min_y + node->max_y;
+        if (i == 0 || cx < min_cx) min_cx = cx;
+        if (i == 0 || cx > max_cx) max_cx = cx;
+        if (i == 0 || cy < min_cy) min_cy = cy;
+        if (i == 0 || cy > max_cy) max_cy = cy;
+    }
+
+    bool split_x = (max_cx - min_cx) >= (max_cy - min_cy);
+    for (int i = 0; i < count; i++) {
+        const AabbTreeNode* node = &tree->nodes[leaves[i].node];
+        leaves[i].center = split_x ? node->min_x + node->max_x : node->min_y + node->max_y;
+    }
+    qsort(leaves, count, sizeof(SortedLeaf), compare_sorted_leaves);
+
+    int half = count / 2;
+    int left = build_range(tree, leaves, half);
+    int right = build_range(tree, leaves + half, count - half);
+    if (left < 0 || right < 0) return -1;
+
+    // Les nœuds internes ont été libérés avant la construction : pas d'allocation qui échoue
+    int parent = allocate_node(tree);
+    if (parent < 0) return -1;
+
+    tree->nodes[parent].left = left;
+    tree->nodes[parent].right = right;
+    tree->nodes[left].parent = parent;
+    tree->nodes[right].parent = parent;
+    merge_boxes(&tree->nodes[left], &tree->nodes[right], &tree->nodes[parent]);
+    tree->nodes[parent].height = 1 + (tree->nodes[left].height > tree->nodes[right].height
+                                      ? tree->nodes[left].height : tree->nodes[right].height);
+    return parent;
+}
+
+// Initialise un arbre vide
+AabbTree* aabb_tree_init(void) {
+    AabbTree* tree = (AabbTree*)calloc(1, sizeof(AabbTree));
+    if (!check_ptr(tree, LOG_LEVEL_ERROR, "Échec d'allocation de l'arbre de boîtes")) {
+        return NULL;
+    }
+
+    tree->root = -1;
+    tree->free_node = -1;
+    if (!ensure_sparse(tree, 0) || !ensure_stack(tree)) {
+        aabb_tree_shutdown(tree);
+        return NULL;
+    }
+    return tree;
+}
+
+// Libère un arbre
+void aabb_tree_shutdown(AabbTree* tree) {
+    if (!tree) return;
+
+    free(tree->nodes);
+    free(tree->sparse);
+    free(tree->stack);
+    free(tree);
+}
+
+// Ajoute ou remplace la boîte d'une entité
+bool aabb_tree_insert(AabbTree* tree, EntityID entity_id, float min_x, float min_y, float max_x, float max_y) {
+    if (!tree || entity_id == INVALID_ENTITY_ID) return false;
+
+    uint32_t index = ENTITY_INDEX(entity_id);
+    if (!ensure_sparse(tree, index)) return false;
+
+    // Feuille déjà présente pour cet index : celle de l'entité elle-même, ou celle d'une
+    // ancienne génération pas encore retirée, qui resterait sinon dans l'arbre
+    if (tree->sparse[index] >= 0) {
+        drop_leaf(tree, tree->sparse[index]);
+    }
+
+    int leaf = allocate_node(tree);
+    if (leaf < 0) return false;
+
+    AabbTreeNode* node = &tree->nodes[leaf];
+    node->min_x = min_x;
+    node->min_y = min_y;
+    node->max_x = max_x;
+    node->max_y = max_y;
+    node->entity = entity_id;
+
+    if (!insert_leaf(tree, leaf)) {
+        free_node(tree, leaf);
+        return false;
+    }
+    tree->sparse[index] = leaf;
+    tree->leaf_count++;
+
+    // L'insertion gloutonne ne rééquilibre pas : reconstruire si l'arbre s'allonge trop
+    if (tree->nodes[tree->root].height > height_limit(tree->leaf_count)) {
+        return aabb_tree_rebuild(tree);
+    }
+    return ensure_stack(tree);
+}
+
+// Retire la boîte d'une entité
+bool aabb_tree_remove(AabbTree* tree, EntityID entity_id) {
+    int leaf = find_leaf(tree, entity_id);
+    if (leaf < 0) return false;
+
+    drop_leaf(tree, leaf);
+    return true;
+}
+
+// Indique si une entité est dans l'arbre
+bool aabb_tree_contains(const AabbTree* tree, EntityID entity_id) {
+    return find_leaf(tree, entity_id) >= 0;
+}
+
+// Reconstruit l'arbre de haut en bas
+bool aabb_tree_rebuild(AabbTree* tree) {
+    if (!tree) return false;
+    if (tree->leaf_count <= 1) return ensure_stack(tree);
+
+    SortedLeaf* leaves = (SortedLeaf*)malloc(tree->leaf_count * sizeof(SortedLeaf));
+    if (!check_ptr(leaves, LOG_LEVEL_ERROR, "Échec d'allocation pour la reconstruction de l'arbre")) {
+        return false;
+    }
+
+    // Garder les feuilles, libérer tous les nœuds internes
+    int count = 0;
+    for (int i = 0; i < tree->node_count; i++) {
+        AabbTreeNode* node = &tree->nodes[i];
+        if (node->height == 0) {
+            node->parent = -1;
+            leaves[count].node = i;
+            count++;
+        } else if (node->height > 0) {
+            free_node(tree, i);
+        }
+    }
+
+    tree->root = build_range(tree, leaves, count);
+    free(leaves);
+
+    if (tree->root < 0) {
+        log_error("Échec de la reconstruction de l'arbre de boîtes");
+        return false;
+    }
+    return ensure_stack(tree);
+}
+
+// Trouve les entités dont la boîte touche une zone
+int aabb_tree_query(AabbTree* tree, float min_x, float min_y, float max_x, float max_y,
+                    EntityID* out_entities, int max_entities) {
+    if (!tree || tree->root < 0 || (!out_entities && max_entities > 0)) return 0;
+
+    int found = 0;
+    int top = 0;
+    tree->stack[top++] = tree->root;
+
+    while (top > 0) {
+        const AabbTreeNode* node = &tree->nodes[tree->stack[--top]];
+        if (node->max_x < min_x || node->min_x > max_x || node->max_y < min_y || node->min_y > max_y) {
+            continue;
+        }
+
+        if (node->height == 0) {
+            if (found < max_entities) out_entities[found] = node->entity;
+            found++;
+        } else {
+            tree->stack[top++] = node->left;
+            tree->stack[top++] = node->right;
+        }
+    }
+
+    return found;
+}
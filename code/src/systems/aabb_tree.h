@@ -0,0 +1,106 @@
+/**
+ * aabb_tree.h
+ * Arbre de boîtes englobantes (BVH) pour les colliders immobiles
+ */
+
+#ifndef AABB_TREE_H
+#define AABB_TREE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../core/entity.h"
+
+// Nœud de l'arbre : feuille (une entité) ou nœud interne (deux enfants)
+typedef struct {
+    float min_x, min_y;      // Coin supérieur gauche de la boîte
+    float max_x, max_y;      // Coin inférieur droit de la boîte
+    EntityID entity;         // Entité de la feuille (INVALID_ENTITY_ID pour un nœud interne)
+    int parent;              // Nœud parent (-1 pour la racine) ou nœud libre suivant
+    int left;                // Premier enfant (-1 pour une feuille)
+    int right;               // Second enfant (-1 pour une feuille)
+    int height;              // 0 pour une feuille, -1 pour un nœud libre
+} AabbTreeNode;
+
+// Arbre de boîtes englobantes
+typedef struct {
+    AabbTreeNode* nodes;         // Nœuds (feuilles et internes)
+    int node_count;              // Nombre de nœuds alloués (libres compris)
+    int node_capacity;           // Taille du tableau de nœuds
+    int free_node;               // Premier nœud libre (-1 si aucun)
+    int root;                    // Racine (-1 si l'arbre est vide)
+    int leaf_count;              // Nombre d'entités dans l'arbre
+
+    int* sparse;                 // Index d'entité -> feuille (-1 si absente)
+    uint32_t sparse_capacity;    // Taille du tableau sparse
+
+    int* stack;                  // Pile de parcours réutilisée par les requêtes
+    int stack_capacity;          // Taille de la pile
+} AabbTree;
+
+/**
+ * Initialise un arbre vide
+ * @return Pointeur vers l'arbre ou NULL en cas d'erreur
+ */
+AabbTree* aabb_tree_init(void);
+
+/**
+ * Libère un arbre
+ * @param tree Arbre à libérer
+ */
+void aabb_tree_shutdown(AabbTree* tree);
+
+/**
+ * Ajoute ou remplace la boîte d'une entité
+ * La feuille est placée à côté du nœud qui augmente le moins le périmètre total ;
+ * les boîtes des ancêtres sont réajustées. Si l'arbre devient trop profond,
+ * il est reconstruit. Une ancienne génération encore présente au même index
+ * d'entité est retirée.
+ * @param tree Arbre
+ * @param entity_id ID de l'entité
+ * @param min_x Bord gauche
+ * @param min_y Bord haut
+ * @param max_x Bord droit
+ * @param max_y Bord bas
+ * @return true si la boîte a été insérée, false en cas d'erreur
+ */
+bool aabb_tree_insert(AabbTree* tree, EntityID entity_id, float min_x, float min_y, float max_x, float max_y);
+
+/**
+ * Retire la boîte d'une entité et réajuste les ancêtres
+ * @param tree Arbre
+ * @param entity_id ID de l'entité
+ * @return true si la boîte a été retirée, false si elle n'était pas dans l'arbre
+ */
+bool aabb_tree_remove(AabbTree* tree, EntityID entity_id);
+
+/**
+ * Indique si une entité est dans l'arbre
+ * @param tree Arbre
+ * @param entity_id ID de l'entité
+ * @return true si l'entité a une feuille
+ */
+bool aabb_tree_contains(const AabbTree* tree, EntityID entity_id);
+
+/**
+ * Reconstruit l'arbre de haut en bas (découpe à la médiane sur l'axe le plus long)
+ * À appeler après un chargement en masse pour obtenir un arbre équilibré.
+ * @param tree Arbre
+ * @return true si la reconstruction a réussi, false sinon
+ */
+bool aabb_tree_rebuild(AabbTree* tree);
+
+/**
+ * Trouve les entités dont la boîte touche une zone
+ * @param tree Arbre
+ * @param min_x Bord gauche de la zone
+ * @param min_y Bord haut de la zone
+ * @param max_x Bord droit de la zone
+ * @param max_y Bord bas de la zone
+ * @param out_entities Tableau pour stocker les entités trouvées
+ * @param max_entities Taille du tableau
+ * @return Nombre total d'entités trouvées (seules les max_entities premières sont écrites)
+ */
+int aabb_tree_query(AabbTree* tree, float min_x, float min_y, float max_x, float max_y,
+                    EntityID* out_entities, int max_entities);
+
+#endif /* AABB_TREE_H */
@@ -0,0 +1,387 @@
+/**
+ * archetype.c
+ * Implémentation du stockage des composants par archétypes
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../systems/archetype.h"
+#include "../utils/error_handler.h"
+
+// Arrondit une taille au multiple d'alignement supérieur
+static size_t align_up(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Calcule la disposition des colonnes et le nombre de lignes par chunk
+static bool compute_layout(Archetype* archetype, const size_t* component_sizes) {
+    size_t row_size = sizeof(EntityID);
+    for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+        if (HAS_COMPONENT(archetype->mask, type) && component_sizes[type] > 0) {
+            row_size += component_sizes[type] + sizeof(uint32_t);
+        }
+    }
+
+    // Partir du maximum théorique et réduire jusqu'à ce que les colonnes alignées tiennent
+    for (int rows = (int)(ARCHETYPE_CHUNK_SIZE / row_size); rows > 0; rows--) {
+        size_t offset = align_up((size_t)rows * sizeof(EntityID), ARCHETYPE_COLUMN_ALIGN);
+
+        for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+            archetype->column_offsets[type] = 0;
+            if (HAS_COMPONENT(archetype->mask, type) && component_sizes[type] > 0) {
+                archetype->column_offsets[type] = offset;
+                offset = align_up(offset + (size_t)rows * component_sizes[type], ARCHETYPE_COLUMN_ALIGN);
+            }
+        }
+
+        // Les ticks de modification suivent les colonnes de composants
+        for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+            archetype->tick_offsets[type] = 0;
+            if (HAS_COMPONENT(archetype->mask, type) && component_sizes[type] > 0) {
+                archetype->tick_offsets[type] = offset;
+                offset = align_up(offset + (size_t)rows * sizeof(uint32_t), ARCHETYPE_COLUMN_ALIGN);
+            }
+        }
+
+        if (offset <= ARCHETYPE_CHUNK_SIZE) {
+            archetype->rows_per_chunk = rows;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Adresse de la ligne d'une colonne (type = -1 pour la colonne des ID)
+static void* column_row(const ArchetypeStorage* storage, const Archetype* archetype, int row, int type) {
+    const ArchetypeChunk* chunk = &archetype->chunks[row / archetype->rows_per_chunk];
+    int local_row = row % archetype->rows_per_chunk;
+
+    if (type < 0) {
+        return chunk->data + (size_t)local_row * sizeof(EntityID);
+    }
+
+    return chunk->data + archetype->column_offsets[type] +
+           (size_t)local_row * storage->component_sizes[type];
+}
+
+// Adresse du tick de modification d'une ligne pour un type
+static uint32_t* tick_row(const Archetype* archetype, int row, int type) {
+    const ArchetypeChunk* chunk = &archetype->chunks[row / archetype->rows_per_chunk];
+    int local_row = row % archetype->rows_per_chunk;
+
+    return (uint32_t*)(chunk->data + archetype->tick_offsets[type]) + local_row;
+}
+
+// Indique si un type occupe une colonne dans l'archétype
+static bool has_column(const ArchetypeStorage* storage, const Archetype* archetype, int type) {
+    return HAS_COMPONENT(archetype->mask, type) && storage->component_sizes[type] > 0;
+}
+
+// Initialise le stockage par archétypes
+ArchetypeStorage* archetype_storage_init(const size_t* component_sizes) {
+    if (!component_sizes) return NULL;
+
+    ArchetypeStorage* storage = (ArchetypeStorage*)calloc(1, sizeof(ArchetypeStorage));
+    if (!check_ptr(storage, LOG_LEVEL_ERROR, "Échec d'allocation du stockage par archétypes")) {
+        return NULL;
+    }
+
+    memcpy(storage->component_sizes, component_sizes, sizeof(storage->component_sizes));
+    return storage;
+}
+
+// Libère le stockage par archétypes et tous ses chunks
+void archetype_storage_shutdown(ArchetypeStorage* storage) {
+    if (!storage) return;
+
+    for (int i = 0; i < storage->archetype_count; i++) {
+        Archetype* archetype = storage->archetypes[i];
+        for (int c = 0; c < archetype->chunk_count; c++) {
+            free(archetype->chunks[c].data);
+        }
+        free(archetype->chunks);
+        free(archetype);
+    }
+
+    free(storage->archetypes);
+    free(storage);
+}
+
+// Trouve l'archétype correspondant à un masque sans le créer
+int archetype_storage_find(const ArchetypeStorage* storage, ComponentMask mask) {
+    if (!storage) return -1;
+
+    for (int i = 0; i < storage->archetype_count; i++) {
+        if (storage->archetypes[i]->mask == mask) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Calcule le nombre d'entités par chunk d'un masque sans créer d'archétype
+int archetype_layout_rows(const ArchetypeStorage* storage, ComponentMask mask) {
+    if (!storage) return 0;
+
+    int existing = archetype_storage_find(storage, mask);
+    if (existing >= 0) return storage->archetypes[existing]->rows_per_chunk;
+
+    Archetype layout;
+    layout.mask = mask;
+    return compute_layout(&layout, storage->component_sizes) ? layout.rows_per_chunk : 0;
+}
+
+// Trouve ou crée l'archétype correspondant à un masque
+int archetype_storage_get(ArchetypeStorage* storage, ComponentMask mask) {
+    if (!storage) return -1;
+
+    int existing = archetype_storage_find(storage, mask);
+    if (existing >= 0) return existing;
+
+    if (storage->archetype_count >= storage->archetype_capacity) {
+        int new_capacity = storage->archetype_capacity ? storage->archetype_capacity * 2 : 16;
+        Archetype** new_archetypes = (Archetype**)realloc(
+            storage->archetypes, new_capacity * sizeof(Archetype*)
+        );
+        if (!check_ptr(new_archetypes, LOG_LEVEL_ERROR, "Échec d'agrandissement de la liste des archétypes")) {
+            return -1;
+        }
+        storage->archetypes = new_archetypes;
+        storage->archetype_capacity = new_capacity;
+    }
+
+    Archetype* archetype = (Archetype*)calloc(1, sizeof(Archetype));
+    if (!check_ptr(archetype, LOG_LEVEL_ERROR, "Échec d'allocation d'un archétype")) {
+        return -1;
+    }
+
+    archetype->mask = mask;
+    for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+        archetype->add_edges[type] = -1;
+        archetype->remove_edges[type] = -1;
+    }
+
+    if (!compute_layout(archetype, storage->component_sizes)) {
+        log_error("Archétype trop volumineux pour un chunk (masque 0x%x)", mask);
+        free(archetype);
+        return -1;
+    }
+
+    storage->archetypes[storage->archetype_count] = archetype;
+    log_debug("Archétype créé (masque 0x%x, %d entités par chunk)", mask, archetype->rows_per_chunk);
+    return storage->archetype_count++;
+}
+
+// Trouve l'archétype obtenu en ajoutant ou retirant un type
+int archetype_storage_neighbor(ArchetypeStorage* storage, int archetype_index,
+                               ComponentType type, bool add) {
+    if (!storage || archetype_index < 0 || archetype_index >= storage->archetype_count) return -1;
+
+    Archetype* archetype = storage->archetypes[archetype_index];
+    int* edge = add ? &archetype->add_edges[type] : &archetype->remove_edges[type];
+
+    if (*edge < 0) {
+        ComponentMask mask = add ? ADD_COMPONENT(archetype->mask, type)
+                                 : REMOVE_COMPONENT(archetype->mask, type);
+        *edge = archetype_storage_get(storage, mask);
+    }
+
+    return *edge;
+}
+
+// Ajoute une ligne vide à la fin d'un archétype
+int archetype_push_row(ArchetypeStorage* storage, int archetype_index, EntityID entity_id) {
+    if (!storage || archetype_index < 0 || archetype_index >= storage->archetype_count) return -1;
+
+    Archetype* archetype = storage->archetypes[archetype_index];
+
+    // Ouvrir un nouveau chunk si le dernier est plein
+    if (archetype->chunk_count == 0 ||
+        archetype->chunks[archetype->chunk_count - 1].count >= archetype->rows_per_chunk) {
+        if (archetype->chunk_count >= archetype->chunk_capacity) {
+            int new_capacity = archetype->chunk_capacity ? archetype->chunk_capacity * 2 : 4;
+            ArchetypeChunk* new_chunks = (ArchetypeChunk*)realloc(
+                archetype->chunks, new_capacity * sizeof(ArchetypeChunk)
+            );
+            if (!check_ptr(new_chunks, LOG_LEVEL_ERROR, "Échec d'agrandissement de la liste des chunks")) {
+                return -1;
+            }
+            archetype->chunks = new_chunks;
+            archetype->chunk_capacity = new_capacity;
+        }
+
+        // Chunk mis à zéro : le bourrage entre colonnes est identique d'une capture à l'autre
+        unsigned char* data = (unsigned char*)calloc(1, ARCHETYPE_CHUNK_SIZE);
+        if (!check_ptr(data, LOG_LEVEL_ERROR, "Échec d'allocation d'un chunk d'archétype")) {
+            return -1;
+        }
+
+        archetype->chunks[archetype->chunk_count].data = data;
+        archetype->chunks[archetype->chunk_count].count = 0;
+        archetype->chunk_count++;
+    }
+
+    int row = archetype->entity_count++;
+    archetype->chunks[archetype->chunk_count - 1].count++;
+
+    // Initialiser la ligne : ID propriétaire et composants à zéro
+    *(EntityID*)column_row(storage, archetype, row, -1) = entity_id;
+    for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+        if (has_column(storage, archetype, type)) {
+            memset(column_row(storage, archetype, row, type), 0, storage->component_sizes[type]);
+            *tick_row(archetype, row, type) = 0;
+        }
+    }
+
+    return row;
+}
+
+// Retire une ligne d'un archétype (la dernière ligne prend sa place)
+EntityID archetype_remove_row(ArchetypeStorage* storage, int archetype_index, int row) {
+    if (!storage || archetype_index < 0 || archetype_index >= storage->archetype_count) {
+        return INVALID_ENTITY_ID;
+    }
+
+    Archetype* archetype = storage->archetypes[archetype_index];
+    if (row < 0 || row >= archetype->entity_count) return INVALID_ENTITY_ID;
+
+    int last_row = archetype->entity_count - 1;
+    EntityID moved_id = INVALID_ENTITY_ID;
+
+    // Combler le trou avec la dernière ligne, colonne par colonne
+    if (row < last_row) {
+        moved_id = *(EntityID*)column_row(storage, archetype, last_row, -1);
+        *(EntityID*)column_row(storage, archetype, row, -1) = moved_id;
+
+        for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+            if (has_column(storage, archetype, type)) {
+                memcpy(column_row(storage, archetype, row, type),
+                       column_row(storage, archetype, last_row, type),
+                       storage->component_sizes[type]);
+                *tick_row(archetype, row, type) = *tick_row(archetype, last_row, type);
+            }
+        }
+    }
+
+    archetype->entity_count--;
+
+    // Libérer le dernier chunk s'il est devenu vide
+    ArchetypeChunk* last_chunk = &archetype->chunks[archetype->chunk_count - 1];
+    if (--last_chunk->count == 0) {
+        free(last_chunk->data);
+        last_chunk->data = NULL;
+        archetype->chunk_count--;
+    }
+
+    return moved_id;
+}
+
+// Déplace une entité vers un autre archétype en copiant les colonnes communes
+int archetype_move_row(ArchetypeStorage* storage, int from_index, int row,
+                       int to_index, EntityID* out_moved) {
+    if (out_moved) *out_moved = INVALID_ENTITY_ID;
+    if (!storage || from_index == to_index) return -1;
+
+    Archetype* from = storage->archetypes[from_index];
+    Archetype* to = storage->archetypes[to_index];
+    EntityID entity_id = *(EntityID*)column_row(storage, from, row, -1);
+
+    int new_row = archetype_push_row(storage, to_index, entity_id);
+    if (new_row < 0) return -1;
+
+    // Copier les composants présents dans les deux archétypes
+    ComponentMask shared = from->mask & to->mask;
+    for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+        if (HAS_COMPONENT(shared, type) && storage->component_sizes[type] > 0) {
+            memcpy(column_row(storage, to, new_row, type),
+                   column_row(storage, from, row, type),
+                   storage->component_sizes[type]);
+            *tick_row(to, new_row, type) = *tick_row(from, row, type);
+        }
+    }
+
+    EntityID moved_id = archetype_remove_row(storage, from_index, row);
+    if (out_moved) *out_moved = moved_id;
+
+    return new_row;
+}
+
+// Fixe le nombre d'entités d'un archétype
+bool archetype_resize(ArchetypeStorage* storage, int archetype_index, int entity_count) {
+    if (!storage || archetype_index < 0 || archetype_index >= storage->archetype_count || entity_count < 0) {
+        return false;
+    }
+
+    Archetype* archetype = storage->archetypes[archetype_index];
+    int rows = archetype->rows_per_chunk;
+    int needed = (entity_count + rows - 1) / rows;
+
+    if (needed > archetype->chunk_capacity) {
+        ArchetypeChunk* new_chunks = (ArchetypeChunk*)realloc(archetype->chunks, needed * sizeof(ArchetypeChunk));
+        if (!check_ptr(new_chunks, LOG_LEVEL_ERROR, "Échec d'agrandissement de la liste des chunks")) {
+            return false;
+        }
+        archetype->chunks = new_chunks;
+        archetype->chunk_capacity = needed;
+    }
+
+    // Les chunks existants sont conservés, seuls les manquants ou en trop changent
+    while (archetype->chunk_count < needed) {
+        unsigned char* data = (unsigned char*)calloc(1, ARCHETYPE_CHUNK_SIZE);
+        if (!check_ptr(data, LOG_LEVEL_ERROR, "Échec d'allocation d'un chunk d'archétype")) {
+            return false;
+        }
+        archetype->chunks[archetype->chunk_count].data = data;
+        archetype->chunks[archetype->chunk_count].count = 0;
+        archetype->chunk_count++;
+    }
+    while (archetype->chunk_count > needed) {
+        archetype->chunk_count--;
+        free(archetype->chunks[archetype->chunk_count].data);
+        archetype->chunks[archetype->chunk_count].data = NULL;
+    }
+
+    // Tous les chunks sont pleins sauf le dernier
+    for (int c = 0; c < needed; c++) {
+        archetype->chunks[c].count = c < needed - 1 ? rows : entity_count - c * rows;
+    }
+    archetype->entity_count = entity_count;
+    return true;
+}
+
+// Récupère l'adresse d'un composant dans un archétype
+void* archetype_get_component(ArchetypeStorage* storage, int archetype_index, int row, ComponentType type) {
+    if (!storage || archetype_index < 0 || archetype_index >= storage->archetype_count) return NULL;
+
+    Archetype* archetype = storage->archetypes[archetype_index];
+    if (row < 0 || row >= archetype->entity_count || !has_column(storage, archetype, type)) {
+        return NULL;
+    }
+
+    return column_row(storage, archetype, row, type);
+}
+
+// Récupère le tick de modification d'un composant dans un archétype
+uint32_t* archetype_get_tick(ArchetypeStorage* storage, int archetype_index, int row, ComponentType type) {
+    if (!storage || archetype_index < 0 || archetype_index >= storage->archetype_count) return NULL;
+
+    Archetype* archetype = storage->archetypes[archetype_index];
+    if (row < 0 || row >= archetype->entity_count || !has_column(storage, archetype, type)) {
+        return NULL;
+    }
+
+    return tick_row(archetype, row, type);
+}
+
+// Récupère l'ID de l'entité stockée à une ligne
+EntityID archetype_get_entity(ArchetypeStorage* storage, int archetype_index, int row) {
+    if (!storage || archetype_index < 0 || archetype_index >= storage->archetype_count) {
+        return INVALID_ENTITY_ID;
+    }
+
+    Archetype* archetype = storage->archetypes[archetype_index];
+    if (row < 0 || row >= archetype->entity_count) return INVALID_ENTITY_ID;
+
+    return *(EntityID*)column_row(storage, archetype, row, -1);
+}
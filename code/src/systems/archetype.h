@@ -0,0 +1,172 @@
+/**
+ * archetype.h
+ * Stockage des composants par archétypes (chunks de 16 Ko en colonnes SoA)
+ */
+
+#ifndef ARCHETYPE_H
+#define ARCHETYPE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "../core/entity.h"
+
+// Taille d'un chunk d'archétype en octets
+#define ARCHETYPE_CHUNK_SIZE (16 * 1024)
+
+// Alignement des colonnes à l'intérieur d'un chunk
+#define ARCHETYPE_COLUMN_ALIGN 16
+
+// Chunk : bloc de 16 Ko contenant la colonne des ID, une colonne par composant puis leurs ticks
+typedef struct {
+    unsigned char* data;   // Mémoire du chunk (ARCHETYPE_CHUNK_SIZE octets)
+    int count;             // Nombre d'entités stockées dans le chunk
+} ArchetypeChunk;
+
+// Archétype : ensemble des entités partageant exactement le même masque de stockage
+typedef struct {
+    ComponentMask mask;                               // Composants stockés
+    int rows_per_chunk;                               // Nombre d'entités par chunk
+    size_t column_offsets[COMPONENT_TYPE_COUNT];      // Position de chaque colonne dans le chunk
+    size_t tick_offsets[COMPONENT_TYPE_COUNT];        // Position de la colonne de ticks de modification
+    ArchetypeChunk* chunks;                           // Chunks (tous pleins sauf le dernier)
+    int chunk_count;                                  // Nombre de chunks utilisés
+    int chunk_capacity;                               // Taille allouée du tableau de chunks
+    int entity_count;                                 // Nombre total d'entités
+    int add_edges[COMPONENT_TYPE_COUNT];              // Archétype obtenu en ajoutant un type (-1 si inconnu)
+    int remove_edges[COMPONENT_TYPE_COUNT];           // Archétype obtenu en retirant un type (-1 si inconnu)
+} Archetype;
+
+// Ensemble des archétypes d'un gestionnaire d'entités
+typedef struct {
+    Archetype** archetypes;                           // Archétypes (pointeurs stables)
+    int archetype_count;                              // Nombre d'archétypes
+    int archetype_capacity;                           // Taille allouée du tableau
+    size_t component_sizes[COMPONENT_TYPE_COUNT];     // Taille de chaque type de composant
+} ArchetypeStorage;
+
+// Emplacement d'une entité dans le stockage par archétypes
+typedef struct {
+    int archetype;         // Index de l'archétype (-1 si l'entité n'a aucun composant stocké)
+    int row;               // Ligne de l'entité dans l'archétype
+} ArchetypeLocation;
+
+/**
+ * Initialise le stockage par archétypes
+ * @param component_sizes Taille de chaque type de composant (0 pour un type sans données)
+ * @return Pointeur vers le stockage ou NULL en cas d'erreur
+ */
+ArchetypeStorage* archetype_storage_init(const size_t* component_sizes);
+
+/**
+ * Libère le stockage par archétypes et tous ses chunks
+ * @param storage Stockage à libérer
+ */
+void archetype_storage_shutdown(ArchetypeStorage* storage);
+
+/**
+ * Trouve l'archétype correspondant à un masque sans le créer
+ * @param storage Stockage par archétypes
+ * @param mask Masque de composants stockés
+ * @return Index de l'archétype ou -1 s'il n'existe pas
+ */
+int archetype_storage_find(const ArchetypeStorage* storage, ComponentMask mask);
+
+/**
+ * Calcule le nombre d'entités par chunk d'un masque sans créer d'archétype
+ * @param storage Stockage par archétypes
+ * @param mask Masque de composants stockés
+ * @return Nombre d'entités par chunk ou 0 si une ligne ne tient pas dans un chunk
+ */
+int archetype_layout_rows(const ArchetypeStorage* storage, ComponentMask mask);
+
+/**
+ * Trouve ou crée l'archétype correspondant à un masque
+ * @param storage Stockage par archétypes
+ * @param mask Masque de composants stockés
+ * @return Index de l'archétype ou -1 en cas d'erreur
+ */
+int archetype_storage_get(ArchetypeStorage* storage, ComponentMask mask);
+
+/**
+ * Trouve l'archétype obtenu en ajoutant ou retirant un type (avec cache des transitions)
+ * @param storage Stockage par archétypes
+ * @param archetype_index Archétype de départ
+ * @param type Type de composant ajouté ou retiré
+ * @param add true pour un ajout, false pour un retrait
+ * @return Index de l'archétype cible ou -1 en cas d'erreur
+ */
+int archetype_storage_neighbor(ArchetypeStorage* storage, int archetype_index,
+                               ComponentType type, bool add);
+
+/**
+ * Ajoute une ligne vide (mise à zéro) à la fin d'un archétype
+ * @param storage Stockage par archétypes
+ * @param archetype_index Archétype cible
+ * @param entity_id ID de l'entité propriétaire de la ligne
+ * @return Ligne attribuée ou -1 en cas d'erreur
+ */
+int archetype_push_row(ArchetypeStorage* storage, int archetype_index, EntityID entity_id);
+
+/**
+ * Retire une ligne d'un archétype (la dernière ligne prend sa place)
+ * @param storage Stockage par archétypes
+ * @param archetype_index Archétype concerné
+ * @param row Ligne à retirer
+ * @return ID de l'entité déplacée dans la ligne libérée, ou INVALID_ENTITY_ID si aucune
+ */
+EntityID archetype_remove_row(ArchetypeStorage* storage, int archetype_index, int row);
+
+/**
+ * Déplace une entité vers un autre archétype en copiant les colonnes communes
+ * @param storage Stockage par archétypes
+ * @param from_index Archétype source
+ * @param row Ligne de l'entité dans l'archétype source
+ * @param to_index Archétype cible
+ * @param out_moved ID de l'entité déplacée dans la ligne libérée de la source (peut être NULL)
+ * @return Nouvelle ligne dans l'archétype cible ou -1 en cas d'erreur
+ */
+int archetype_move_row(ArchetypeStorage* storage, int from_index, int row,
+                       int to_index, EntityID* out_moved);
+
+/**
+ * Fixe le nombre d'entités d'un archétype en allouant ou libérant des chunks
+ * Le contenu des lignes ajoutées n'est pas initialisé : l'appelant le remplit
+ * (restauration d'une capture, par exemple).
+ * @param storage Stockage par archétypes
+ * @param archetype_index Archétype concerné
+ * @param entity_count Nouveau nombre d'entités
+ * @return true si le redimensionnement a réussi, false sinon
+ */
+bool archetype_resize(ArchetypeStorage* storage, int archetype_index, int entity_count);
+
+/**
+ * Récupère l'adresse d'un composant dans un archétype
+ * @param storage Stockage par archétypes
+ * @param archetype_index Archétype concerné
+ * @param row Ligne de l'entité
+ * @param type Type du composant
+ * @return Pointeur vers le composant ou NULL si l'archétype ne le stocke pas
+ */
+void* archetype_get_component(ArchetypeStorage* storage, int archetype_index, int row, ComponentType type);
+
+/**
+ * Récupère le tick de modification d'un composant dans un archétype
+ * @param storage Stockage par archétypes
+ * @param archetype_index Archétype concerné
+ * @param row Ligne de l'entité
+ * @param type Type du composant
+ * @return Pointeur vers le tick ou NULL si l'archétype ne stocke pas ce composant
+ */
+uint32_t* archetype_get_tick(ArchetypeStorage* storage, int archetype_index, int row, ComponentType type);
+
+/**
+ * Récupère l'ID de l'entité stockée à une ligne
+ * @param storage Stockage par archétypes
+ * @param archetype_index Archétype concerné
+ * @param row Ligne de l'entité
+ * @return ID de l'entité
+ */
+EntityID archetype_get_entity(ArchetypeStorage* storage, int archetype_index, int row);
+
+#endif /* ARCHETYPE_H */
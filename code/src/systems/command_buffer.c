@@ -0,0 +1,243 @@
+/**
+ * command_buffer.c
+ * Implémentation du tampon de commandes différées
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../systems/command_buffer.h"
+#include "../utils/error_handler.h"
+
+// Capacités initiales
+#define INITIAL_COMMAND_CAPACITY 64
+#define INITIAL_DATA_CAPACITY 4096
+
+// Alignement des composants copiés dans le tampon de données
+#define COMMAND_DATA_ALIGN 16
+
+// Ajoute une commande à la fin du tampon
+static EntityCommand* push_command(EntityCommandBuffer* buffer, EntityCommandType type, EntityID entity_id) {
+    if (buffer->command_count >= buffer->command_capacity) {
+        int new_capacity = buffer->command_capacity ? buffer->command_capacity * 2 : INITIAL_COMMAND_CAPACITY;
+        EntityCommand* new_commands = (EntityCommand*)realloc(
+            buffer->commands, new_capacity * sizeof(EntityCommand)
+        );
+        if (!check_ptr(new_commands, LOG_LEVEL_ERROR, "Échec d'agrandissement du tampon de commandes")) {
+            return NULL;
+        }
+        buffer->commands = new_commands;
+        buffer->command_capacity = new_capacity;
+    }
+
+    EntityCommand* command = &buffer->commands[buffer->command_count++];
+    command->type = type;
+    command->entity = entity_id;
+    command->component_type = COMPONENT_TYPE_COUNT;
+    command->data_offset = 0;
+    return command;
+}
+
+// Réserve de la place dans le tampon de données et renvoie sa position
+static bool reserve_data(EntityCommandBuffer* buffer, size_t size, size_t* out_offset) {
+    size_t offset = (buffer->data_size + COMMAND_DATA_ALIGN - 1) & ~(size_t)(COMMAND_DATA_ALIGN - 1);
+
+    if (offset + size > buffer->data_capacity) {
+        size_t new_capacity = buffer->data_capacity ? buffer->data_capacity : INITIAL_DATA_CAPACITY;
+        while (new_capacity < offset + size) {
+            new_capacity *= 2;
+        }
+
+        unsigned char* new_data = (unsigned char*)realloc(buffer->data, new_capacity);
+        if (!check_ptr(new_data, LOG_LEVEL_ERROR, "Échec d'agrandissement des données du tampon de commandes")) {
+            return false;
+        }
+        buffer->data = new_data;
+        buffer->data_capacity = new_capacity;
+    }
+
+    buffer->data_size = offset + size;
+    *out_offset = offset;
+    return true;
+}
+
+// Remplace un ID provisoire par l'ID réel attribué au rejeu
+static EntityID resolve_entity(const EntityCommandBuffer* buffer, EntityID entity_id) {
+    if (!ENTITY_IS_PENDING(entity_id)) return entity_id;
+
+    uint32_t pending = ENTITY_INDEX(entity_id) - 1;
+    if (pending >= (uint32_t)buffer->pending_count) return INVALID_ENTITY_ID;
+
+    return buffer->resolved[pending];
+}
+
+// Initialise un tampon de commandes
+EntityCommandBuffer* command_buffer_init(void) {
+    EntityCommandBuffer* buffer = (EntityCommandBuffer*)calloc(1, sizeof(EntityCommandBuffer));
+    if (!check_ptr(buffer, LOG_LEVEL_ERROR, "Échec d'allocation du tampon de commandes")) {
+        return NULL;
+    }
+
+    return buffer;
+}
+
+// Libère un tampon de commandes
+void command_buffer_shutdown(EntityCommandBuffer* buffer) {
+    if (!buffer) return;
+
+    free(buffer->commands);
+    free(buffer->data);
+    free(buffer->resolved);
+    free(buffer);
+}
+
+// Enregistre la création d'une entité
+EntityID command_buffer_create_entity(EntityCommandBuffer* buffer) {
+    if (!buffer) return INVALID_ENTITY_ID;
+
+    // L'index 0 n'est jamais utilisé : les ID provisoires commencent à 1
+    if ((uint32_t)buffer->pending_count >= ENTITY_INDEX_MASK) {
+        log_error("Trop de créations d'entités en attente dans le tampon de commandes");
+        return INVALID_ENTITY_ID;
+    }
+
+    // Préparer la place de l'ID réel pour que le rejeu n'alloue rien
+    if (buffer->pending_count >= buffer->resolved_capacity) {
+        int new_capacity = buffer->resolved_capacity ? buffer->resolved_capacity * 2 : INITIAL_COMMAND_CAPACITY;
+        EntityID* new_resolved = (EntityID*)realloc(buffer->resolved, new_capacity * sizeof(EntityID));
+        if (!check_ptr(new_resolved, LOG_LEVEL_ERROR, "Échec d'agrandissement des créations en attente")) {
+            return INVALID_ENTITY_ID;
+        }
+        buffer->resolved = new_resolved;
+        buffer->resolved_capacity = new_capacity;
+    }
+
+    EntityID pending_id = MAKE_ENTITY_ID(buffer->pending_count + 1, ENTITY_PENDING_GENERATION);
+    if (!push_command(buffer, COMMAND_CREATE_ENTITY, pending_id)) {
+        return INVALID_ENTITY_ID;
+    }
+
+    buffer->resolved[buffer->pending_count++] = INVALID_ENTITY_ID;
+    return pending_id;
+}
+
+// Enregistre la destruction d'une entité
+bool command_buffer_destroy_entity(EntityCommandBuffer* buffer, EntityID entity_id) {
+    if (!buffer || entity_id == INVALID_ENTITY_ID) return false;
+
+    return push_command(buffer, COMMAND_DESTROY_ENTITY, entity_id) != NULL;
+}
+
+// Enregistre l'ajout d'un composant
+bool command_buffer_add_component(EntityCommandBuffer* buffer, EntityID entity_id, const void* component) {
+    if (!buffer || !component || entity_id == INVALID_ENTITY_ID) return false;
+
+    ComponentType type = ((const Component*)component)->type;
+    size_t size = entity_component_size(type);
+    if (size == 0) {
+        log_error("Type de composant invalide (%d) dans le tampon de commandes", type);
+        return false;
+    }
+
+    // Copier le composant tout de suite : l'appelant peut réutiliser sa structure
+    size_t offset;
+    if (!reserve_data(buffer, size, &offset)) return false;
+    memcpy(buffer->data + offset, component, size);
+
+    EntityCommand* command = push_command(buffer, COMMAND_ADD_COMPONENT, entity_id);
+    if (!command) return false;
+
+    command->component_type = type;
+    command->data_offset = offset;
+    return true;
+}
+
+// Enregistre le retrait d'un composant
+bool command_buffer_remove_component(EntityCommandBuffer* buffer, EntityID entity_id, ComponentType component_type) {
+    if (!buffer || entity_id == INVALID_ENTITY_ID || component_type >= COMPONENT_TYPE_COUNT) return false;
+
+    EntityCommand* command = push_command(buffer, COMMAND_REMOVE_COMPONENT, entity_id);
+    if (!command) return false;
+
+    command->component_type = component_type;
+    return true;
+}
+
+// Enregistre la pose d'un tag
+bool command_buffer_add_tag(EntityCommandBuffer* buffer, EntityID entity_id, ComponentType tag) {
+    if (!buffer || entity_id == INVALID_ENTITY_ID || tag >= COMPONENT_TYPE_COUNT) return false;
+
+    if (!IS_TAG_COMPONENT(tag)) {
+        log_error("Type %d enregistré comme tag dans le tampon de commandes", tag);
+        return false;
+    }
+
+    EntityCommand* command = push_command(buffer, COMMAND_ADD_TAG, entity_id);
+    if (!command) return false;
+
+    command->component_type = tag;
+    return true;
+}
+
+// Rejoue toutes les commandes puis vide le tampon
+int command_buffer_playback(EntityCommandBuffer* buffer, EntityManager* manager) {
+    if (!buffer || !manager) return 0;
+
+    int applied = 0;
+    int next_pending = 0;
+
+    for (int i = 0; i < buffer->command_count; i++) {
+        EntityCommand* command = &buffer->commands[i];
+
+        if (command->type == COMMAND_CREATE_ENTITY) {
+            EntityID created = entity_create(manager);
+            buffer->resolved[next_pending++] = created;
+            if (created != INVALID_ENTITY_ID) applied++;
+            continue;
+        }
+
+        // Une entité dont la création a échoué ou qui a déjà été détruite est ignorée
+        EntityID entity_id = resolve_entity(buffer, command->entity);
+        if (entity_id == INVALID_ENTITY_ID) continue;
+
+        bool success = false;
+        switch (command->type) {
+            case COMMAND_DESTROY_ENTITY:
+                success = entity_destroy(manager, entity_id);
+                break;
+
+            case COMMAND_ADD_COMPONENT: {
+                // Le composant copié porte encore l'ID provisoire : le corriger avant l'ajout
+                Component* component = (Component*)(buffer->data + command->data_offset);
+                component->entity = entity_id;
+                success = entity_add_component(manager, entity_id, component);
+                break;
+            }
+
+            case COMMAND_REMOVE_COMPONENT:
+                success = entity_remove_component(manager, entity_id, command->component_type);
+                break;
+
+            case COMMAND_ADD_TAG:
+                success = entity_set_tag(manager, entity_id, command->component_type, true);
+                break;
+
+            default:
+                break;
+        }
+
+        if (success) applied++;
+    }
+
+    log_debug("Tampon de commandes rejoué : %d/%d commandes appliquées", applied, buffer->command_count);
+    command_buffer_clear(buffer);
+    return applied;
+}
+
+// Vide le tampon sans appliquer les commandes
+void command_buffer_clear(EntityCommandBuffer* buffer) {
+    if (!buffer) return;
+
+    buffer->command_count = 0;
+    buffer->data_size = 0;
+    buffer->pending_count = 0;
+}
@@ -0,0 +1,118 @@
+/**
+ * command_buffer.h
+ * Tampon de commandes différées pour les changements structurels d'entités
+ */
+
+#ifndef COMMAND_BUFFER_H
+#define COMMAND_BUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "../core/entity.h"
+#include "../systems/entity_manager.h"
+
+// Types de commandes enregistrables
+typedef enum {
+    COMMAND_CREATE_ENTITY,      // Création d'une entité (ID provisoire)
+    COMMAND_DESTROY_ENTITY,     // Destruction d'une entité
+    COMMAND_ADD_COMPONENT,      // Ajout d'un composant (copié dans le tampon)
+    COMMAND_REMOVE_COMPONENT,   // Retrait d'un composant (ou d'un tag)
+    COMMAND_ADD_TAG             // Pose d'un tag
+} EntityCommandType;
+
+// Commande enregistrée
+typedef struct {
+    EntityCommandType type;        // Type de commande
+    EntityID entity;               // Entité visée (réelle ou provisoire)
+    ComponentType component_type;  // Type de composant ou de tag (ajout/retrait)
+    size_t data_offset;            // Position des données du composant dans le tampon
+} EntityCommand;
+
+// Tampon de commandes : enregistré pendant les mises à jour, rejoué à un point de synchronisation
+typedef struct {
+    EntityCommand* commands;       // Commandes dans l'ordre d'enregistrement
+    int command_count;             // Nombre de commandes
+    int command_capacity;          // Capacité du tableau de commandes
+    unsigned char* data;           // Copies des composants à ajouter
+    size_t data_size;              // Octets utilisés dans le tampon de données
+    size_t data_capacity;          // Capacité du tampon de données
+    int pending_count;             // Nombre d'entités créées en attente
+    EntityID* resolved;            // ID réels des entités créées (rempli au rejeu)
+    int resolved_capacity;         // Capacité du tableau des ID réels
+} EntityCommandBuffer;
+
+// Indique si un ID désigne une entité dont la création est en attente
+#define ENTITY_IS_PENDING(id) (ENTITY_GENERATION(id) == ENTITY_PENDING_GENERATION)
+
+/**
+ * Initialise un tampon de commandes
+ * @return Pointeur vers le tampon ou NULL en cas d'erreur
+ */
+EntityCommandBuffer* command_buffer_init(void);
+
+/**
+ * Libère un tampon de commandes
+ * @param buffer Tampon à libérer
+ */
+void command_buffer_shutdown(EntityCommandBuffer* buffer);
+
+/**
+ * Enregistre la création d'une entité
+ * L'ID renvoyé est provisoire : il n'est utilisable que dans les commandes du même tampon.
+ * @param buffer Tampon de commandes
+ * @return ID provisoire ou INVALID_ENTITY_ID en cas d'erreur
+ */
+EntityID command_buffer_create_entity(EntityCommandBuffer* buffer);
+
+/**
+ * Enregistre la destruction d'une entité
+ * @param buffer Tampon de commandes
+ * @param entity_id ID de l'entité (réel ou provisoire)
+ * @return true si la commande a été enregistrée, false sinon
+ */
+bool command_buffer_destroy_entity(EntityCommandBuffer* buffer, EntityID entity_id);
+
+/**
+ * Enregistre l'ajout d'un composant (le composant est copié immédiatement)
+ * @param buffer Tampon de commandes
+ * @param entity_id ID de l'entité (réel ou provisoire)
+ * @param component Pointeur vers le composant à ajouter
+ * @return true si la commande a été enregistrée, false sinon
+ */
+bool command_buffer_add_component(EntityCommandBuffer* buffer, EntityID entity_id, const void* component);
+
+/**
+ * Enregistre le retrait d'un composant
+ * @param buffer Tampon de commandes
+ * @param entity_id ID de l'entité (réel ou provisoire)
+ * @param component_type Type de composant à retirer
+ * @return true si la commande a été enregistrée, false sinon
+ */
+bool command_buffer_remove_component(EntityCommandBuffer* buffer, EntityID entity_id, ComponentType component_type);
+
+/**
+ * Enregistre la pose d'un tag (le retrait passe par command_buffer_remove_component)
+ * @param buffer Tampon de commandes
+ * @param entity_id ID de l'entité (réel ou provisoire)
+ * @param tag Type de tag à poser
+ * @return true si la commande a été enregistrée, false sinon
+ */
+bool command_buffer_add_tag(EntityCommandBuffer* buffer, EntityID entity_id, ComponentType tag);
+
+/**
+ * Rejoue toutes les commandes dans l'ordre d'enregistrement puis vide le tampon
+ * À appeler hors de tout parcours des entités du gestionnaire.
+ * @param buffer Tampon de commandes
+ * @param manager Gestionnaire d'entités
+ * @return Nombre de commandes appliquées avec succès
+ */
+int command_buffer_playback(EntityCommandBuffer* buffer, EntityManager* manager);
+
+/**
+ * Vide le tampon sans appliquer les commandes
+ * @param buffer Tampon de commandes
+ */
+void command_buffer_clear(EntityCommandBuffer* buffer);
+
+#endif /* COMMAND_BUFFER_H */
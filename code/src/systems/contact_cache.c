@@ -0,0 +1,180 @@
+/**
+ * contact_cache.c
+ * Implémentation du cache de contacts
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../systems/contact_cache.h"
+#include "../utils/error_handler.h"
+
+// Capacité initiale des contacts et des tableaux d'événements
+#define INITIAL_CONTACT_CAPACITY 64
+
+// Seau d'une paire
+static inline int contact_bucket(const ContactCache* cache, EntityID a, EntityID b) {
+    uint32_t h = a * 2654435761u ^ b * 2246822519u;
+    return (int)((h ^ (h >> 15)) & (uint32_t)cache->bucket_mask);
+}
+
+// Agrandit le tableau des contacts et redistribue les seaux (autant de seaux que de places)
+static bool grow_entries(ContactCache* cache) {
+    int new_capacity = cache->entry_capacity ? cache->entry_capacity * 2 : INITIAL_CONTACT_CAPACITY;
+
+    ContactEntry* new_entries = (ContactEntry*)realloc(cache->entries, new_capacity * sizeof(ContactEntry));
+    if (!check_ptr(new_entries, LOG_LEVEL_ERROR, "Échec d'agrandissement du cache de contacts")) {
+        return false;
+    }
+    cache->entries = new_entries;
+
+    int* new_buckets = (int*)malloc(new_capacity * sizeof(int));
+    if (!check_ptr(new_buckets, LOG_LEVEL_ERROR, "Échec d'agrandissement des seaux du cache de contacts")) {
+        return false;
+    }
+    free(cache->buckets);
+    cache->buckets = new_buckets;
+    cache->bucket_mask = new_capacity - 1;
+    cache->entry_capacity = new_capacity;
+
+    for (int i = 0; i < new_capacity; i++) {
+        cache->buckets[i] = -1;
+    }
+    for (int i = 0; i < cache->entry_count; i++) {
+        int bucket = contact_bucket(cache, cache->entries[i].pair.a, cache->entries[i].pair.b);
+        cache->entries[i].next = cache->buckets[bucket];
+        cache->buckets[bucket] = i;
+    }
+    return true;
+}
+
+// Décroche un contact de la chaîne de son seau
+static void unlink_entry(ContactCache* cache, int entry) {
+    const ContactPair* pair = &cache->entries[entry].pair;
+    int* link = &cache->buckets[contact_bucket(cache, pair->a, pair->b)];
+    while (*link != entry) {
+        link = &cache->entries[*link].next;
+    }
+    *link = cache->entries[entry].next;
+}
+
+// Oublie un contact (le dernier contact comble le trou)
+static void remove_entry(ContactCache* cache, int entry) {
+    unlink_entry(cache, entry);
+
+    int last = cache->entry_count - 1;
+    if (entry != last) {
+        unlink_entry(cache, last);
+        cache->entries[entry] = cache->entries[last];
+
+        const ContactPair* pair = &cache->entries[entry].pair;
+        int bucket = contact_bucket(cache, pair->a, pair->b);
+        cache->entries[entry].next = cache->buckets[bucket];
+        cache->buckets[bucket] = entry;
+    }
+    cache->entry_count--;
+}
+
+// Ajoute un événement à la liste de son type
+static bool push_event(ContactCache* cache, ContactEventType type, const ContactPair* pair) {
+    if (cache->event_counts[type] >= cache->event_capacities[type]) {
+        int new_capacity = cache->event_capacities[type] ? cache->event_capacities[type] * 2 : INITIAL_CONTACT_CAPACITY;
+
+        ContactPair* new_events = (ContactPair*)realloc(cache->events[type], new_capacity * sizeof(ContactPair));
+        if (!check_ptr(new_events, LOG_LEVEL_ERROR, "Échec d'agrandissement des événements de contact")) {
+            return false;
+        }
+        cache->events[type] = new_events;
+        cache->event_capacities[type] = new_capacity;
+    }
+
+    cache->events[type][cache->event_counts[type]++] = *pair;
+    return true;
+}
+
+// Initialise un cache vide
+ContactCache* contact_cache_init(void) {
+    ContactCache* cache = (ContactCache*)calloc(1, sizeof(ContactCache));
+    if (!check_ptr(cache, LOG_LEVEL_ERROR, "Échec d'allocation du cache de contacts")) {
+        return NULL;
+    }
+
+    if (!grow_entries(cache)) {
+        contact_cache_shutdown(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+// Libère un cache
+void contact_cache_shutdown(ContactCache* cache) {
+    if (!cache) return;
+
+    free(cache->entries);
+    free(cache->buckets);
+    for (int type = 0; type < CONTACT_EVENT_COUNT; type++) {
+        free(cache->events[type]);
+    }
+    free(cache);
+}
+
+// Commence une image : vide les événements de l'image précédente
+void contact_cache_begin_frame(ContactCache* cache) {
+    if (!cache) return;
+
+    cache->frame++;
+    for (int type = 0; type < CONTACT_EVENT_COUNT; type++) {
+        cache->event_counts[type] = 0;
+    }
+}
+
+// Signale un contact pendant l'image en cours
+bool contact_cache_report(ContactCache* cache, EntityID a, EntityID b) {
+    if (!cache || a == INVALID_ENTITY_ID || b == INVALID_ENTITY_ID) return false;
+
+    for (int i = cache->buckets[contact_bucket(cache, a, b)]; i >= 0; i = cache->entries[i].next) {
+        ContactEntry* entry = &cache->entries[i];
+        if (entry->pair.a != a || entry->pair.b != b) continue;
+
+        // Déjà signalé dans cette image : pas de second événement
+        if (entry->frame == cache->frame) return true;
+
+        entry->frame = cache->frame;
+        return push_event(cache, CONTACT_STAY, &entry->pair);
+    }
+
+    if (cache->entry_count >= cache->entry_capacity && !grow_entries(cache)) {
+        return false;
+    }
+
+    int bucket = contact_bucket(cache, a, b);
+    int index = cache->entry_count++;
+    ContactEntry* entry = &cache->entries[index];
+    entry->pair.a = a;
+    entry->pair.b = b;
+    entry->frame = cache->frame;
+    entry->next = cache->buckets[bucket];
+    cache->buckets[bucket] = index;
+
+    return push_event(cache, CONTACT_ENTER, &entry->pair);
+}
+
+// Termine une image : les contacts non signalés émettent CONTACT_EXIT et sont oubliés
+void contact_cache_end_frame(ContactCache* cache) {
+    if (!cache) return;
+
+    // À rebours : le dernier contact comble le trou d'un contact oublié
+    for (int i = cache->entry_count - 1; i >= 0; i--) {
+        if (cache->entries[i].frame == cache->frame) continue;
+
+        push_event(cache, CONTACT_EXIT, &cache->entries[i].pair);
+        remove_entry(cache, i);
+    }
+}
+
+// Récupère les événements d'un type émis pendant la dernière image
+int contact_cache_get_events(const ContactCache* cache, ContactEventType type, const ContactPair** out_events) {
+    if (!cache || !out_events || type < 0 || type >= CONTACT_EVENT_COUNT) return 0;
+
+    *out_events = cache->events[type];
+    return cache->event_counts[type];
+}
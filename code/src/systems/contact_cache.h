@@ -0,0 +1,94 @@
+/**
+ * contact_cache.h
+ * Cache de contacts entre paires d'entités : événements d'entrée, de maintien et de sortie
+ */
+
+#ifndef CONTACT_CACHE_H
+#define CONTACT_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../core/entity.h"
+
+// Type d'événement de contact
+typedef enum {
+    CONTACT_ENTER,    // Contact apparu à cette image
+    CONTACT_STAY,     // Contact déjà présent à l'image précédente
+    CONTACT_EXIT,     // Contact disparu à cette image
+
+    // Toujours ajouter avant cette ligne
+    CONTACT_EVENT_COUNT
+} ContactEventType;
+
+// Paire d'entités en contact (ordonnée : a est la source du contact, b l'entité touchée)
+typedef struct {
+    EntityID a, b;
+} ContactPair;
+
+// Contact mémorisé d'une image à l'autre
+typedef struct {
+    ContactPair pair;         // Entités en contact
+    uint32_t frame;           // Dernière image où le contact a été signalé
+    int next;                 // Contact suivant du même seau (-1 en fin)
+} ContactEntry;
+
+// Cache de contacts haché
+typedef struct {
+    ContactEntry* entries;                            // Contacts mémorisés (tableau dense)
+    int entry_count;                                  // Nombre de contacts
+    int entry_capacity;                               // Taille du tableau de contacts
+    int* buckets;                                     // Premier contact de chaque seau (-1 si vide)
+    int bucket_mask;                                  // Nombre de seaux - 1 (puissance de 2)
+    uint32_t frame;                                   // Image en cours
+
+    ContactPair* events[CONTACT_EVENT_COUNT];         // Événements de l'image, par type
+    int event_counts[CONTACT_EVENT_COUNT];            // Nombre d'événements de chaque type
+    int event_capacities[CONTACT_EVENT_COUNT];        // Taille de chaque tableau d'événements
+} ContactCache;
+
+/**
+ * Initialise un cache vide
+ * @return Pointeur vers le cache ou NULL en cas d'erreur
+ */
+ContactCache* contact_cache_init(void);
+
+/**
+ * Libère un cache
+ * @param cache Cache à libérer
+ */
+void contact_cache_shutdown(ContactCache* cache);
+
+/**
+ * Commence une image : vide les événements de l'image précédente
+ * @param cache Cache de contacts
+ */
+void contact_cache_begin_frame(ContactCache* cache);
+
+/**
+ * Signale un contact pendant l'image en cours
+ * Émet CONTACT_ENTER si la paire est nouvelle, CONTACT_STAY sinon.
+ * Une paire signalée plusieurs fois dans la même image n'émet qu'un événement.
+ * @param cache Cache de contacts
+ * @param a Source du contact
+ * @param b Entité touchée
+ * @return true si le contact est enregistré, false en cas d'erreur
+ */
+bool contact_cache_report(ContactCache* cache, EntityID a, EntityID b);
+
+/**
+ * Termine une image : les contacts non signalés émettent CONTACT_EXIT et sont oubliés
+ * @param cache Cache de contacts
+ */
+void contact_cache_end_frame(ContactCache* cache);
+
+/**
+ * Récupère les événements d'un type émis pendant la dernière image
+ * Le tableau reste valide jusqu'au prochain contact_cache_begin_frame.
+ * @param cache Cache de contacts
+ * @param type Type d'événement
+ * @param out_events Pointeur à remplir avec le tableau des événements
+ * @return Nombre d'événements
+ */
+int contact_cache_get_events(const ContactCache* cache, ContactEventType type, const ContactPair** out_events);
+
+#endif /* CONTACT_CACHE_H */
@@ -10,42 +10,347 @@
 
 // Taille des composants par type
 static const size_t component_sizes[COMPONENT_TYPE_COUNT] = {
-    sizeof(TransformComponent),    // COMPONENT_TRANSFORM
-    sizeof(SpriteComponent),       // COMPONENT_SPRITE
-    sizeof(ColliderComponent),     // COMPONENT_COLLIDER
-    sizeof(PlayerComponent),       // COMPONENT_PLAYER
-    sizeof(ItemComponent),         // COMPONENT_ITEM
-    sizeof(FarmingComponent),      // COMPONENT_FARMING
-    sizeof(InteractableComponent), // COMPONENT_INTERACTABLE
+    [COMPONENT_TRANSFORM]    = sizeof(TransformComponent),
+    [COMPONENT_SPRITE]       = sizeof(SpriteComponent),
+    [COMPONENT_COLLIDER]     = sizeof(ColliderComponent),
+    [COMPONENT_PLAYER]       = sizeof(PlayerComponent),
+    [COMPONENT_NPC]          = sizeof(Component),  // Pas encore de données spécifiques
+    [COMPONENT_ITEM]         = sizeof(ItemComponent),
+    [COMPONENT_FARMING]      = sizeof(FarmingComponent),
+    [COMPONENT_INTERACTABLE] = sizeof(InteractableComponent),
+    [COMPONENT_ANIMATION]    = sizeof(AnimationComponent),
 };
 
+// Taille initiale de l'index creux des entités
+#define INITIAL_SPARSE_CAPACITY 1024
+
+// Taille initiale des tableaux denses d'entités
+#define INITIAL_ENTITY_CAPACITY 256
+
+// Adresse du composant à une position donnée du pool
+static inline void* pool_slot(const ComponentPool* pool, int slot) {
+    return (char*)pool->pages[slot >> COMPONENT_PAGE_SHIFT] +
+           (size_t)(slot & COMPONENT_PAGE_MASK) * pool->component_size;
+}
+
+// Tick de modification d'une position du pool
+static inline uint32_t* pool_tick(const ComponentPool* pool, int slot) {
+    return pool->tick_pages[slot >> COMPONENT_PAGE_SHIFT] + (slot & COMPONENT_PAGE_MASK);
+}
+
+// S'assure que le pool peut accueillir un composant de plus (alloue une page si besoin)
+static bool pool_reserve_slot(ComponentPool* pool) {
+    int page = pool->count >> COMPONENT_PAGE_SHIFT;
+    if (page < pool->page_count) return true;
+
+    // Agrandir le tableau de pages (seuls les pointeurs de page sont déplacés)
+    if (pool->page_count >= pool->page_capacity) {
+        int new_capacity = pool->page_capacity ? pool->page_capacity * 2 : 4;
+        void** new_pages = (void**)realloc(pool->pages, new_capacity * sizeof(void*));
+        if (!check_ptr(new_pages, LOG_LEVEL_ERROR, "Échec d'agrandissement du tableau de pages")) {
+            return false;
+        }
+        pool->pages = new_pages;
+
+        uint32_t** new_tick_pages = (uint32_t**)realloc(pool->tick_pages, new_capacity * sizeof(uint32_t*));
+        if (!check_ptr(new_tick_pages, LOG_LEVEL_ERROR, "Échec d'agrandissement du tableau de pages de ticks")) {
+            return false;
+        }
+        pool->tick_pages = new_tick_pages;
+        pool->page_capacity = new_capacity;
+    }
+
+    void* new_page = calloc(COMPONENT_PAGE_SIZE, pool->component_size);
+    uint32_t* new_tick_page = (uint32_t*)calloc(COMPONENT_PAGE_SIZE, sizeof(uint32_t));
+    if (!check_ptr(new_page, LOG_LEVEL_ERROR, "Échec d'allocation d'une page de composants") ||
+        !check_ptr(new_tick_page, LOG_LEVEL_ERROR, "Échec d'allocation d'une page de ticks")) {
+        free(new_page);
+        free(new_tick_page);
+        return false;
+    }
+
+    pool->pages[pool->page_count] = new_page;
+    pool->tick_pages[pool->page_count] = new_tick_page;
+    pool->page_count++;
+    return true;
+}
+
+// Libère la dernière page quand le pool a largement reculé (une page d'avance est conservée)
+static void pool_trim(ComponentPool* pool) {
+    while (pool->page_count >= 2 &&
+           pool->count <= (pool->page_count - 2) * COMPONENT_PAGE_SIZE) {
+        pool->page_count--;
+        free(pool->pages[pool->page_count]);
+        free(pool->tick_pages[pool->page_count]);
+        pool->pages[pool->page_count] = NULL;
+        pool->tick_pages[pool->page_count] = NULL;
+    }
+}
+
+// Agrandit les tableaux denses d'entités si nécessaire
+static bool ensure_entity_capacity(EntityManager* manager, int required) {
+    if (required <= manager->entity_capacity) return true;
+
+    int new_capacity = manager->entity_capacity ? manager->entity_capacity : INITIAL_ENTITY_CAPACITY;
+    while (new_capacity < required) {
+        new_capacity *= 2;
+    }
+
+    EntityID* new_entities = (EntityID*)realloc(manager->entities, new_capacity * sizeof(EntityID));
+    if (!check_ptr(new_entities, LOG_LEVEL_ERROR, "Échec d'agrandissement de la liste des entités")) {
+        return false;
+    }
+    manager->entities = new_entities;
+
+    ComponentMask* new_masks = (ComponentMask*)realloc(manager->entity_masks, new_capacity * sizeof(ComponentMask));
+    if (!check_ptr(new_masks, LOG_LEVEL_ERROR, "Échec d'agrandissement des masques d'entités")) {
+        return false;
+    }
+    manager->entity_masks = new_masks;
+
+    manager->entity_capacity = new_capacity;
+    return true;
+}
+
+// Agrandit un tableau creux et marque les nouveaux emplacements comme vides
+static int* grow_sparse_array(int* sparse, uint32_t old_capacity, uint32_t new_capacity) {
+    int* new_sparse = (int*)realloc(sparse, new_capacity * sizeof(int));
+    if (!new_sparse) return NULL;
+
+    for (uint32_t i = old_capacity; i < new_capacity; i++) {
+        new_sparse[i] = -1;
+    }
+
+    return new_sparse;
+}
+
+// Agrandit les index creux pour qu'ils puissent contenir l'index d'entité donné
+static bool ensure_sparse_capacity(EntityManager* manager, uint32_t required) {
+    if (required < manager->sparse_capacity) return true;
+
+    uint32_t old_capacity = manager->sparse_capacity;
+    uint32_t new_capacity = old_capacity ? old_capacity : INITIAL_SPARSE_CAPACITY;
+    while (new_capacity <= required) {
+        new_capacity *= 2;
+    }
+
+    int* new_sparse = grow_sparse_array(manager->entity_sparse, old_capacity, new_capacity);
+    if (!check_ptr(new_sparse, LOG_LEVEL_ERROR, "Échec d'agrandissement de l'index des entités")) {
+        return false;
+    }
+    manager->entity_sparse = new_sparse;
+
+    for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+        // Les tags n'ont pas de pool : leur présence est lue dans le masque
+        if (IS_TAG_COMPONENT(type)) continue;
+
+        new_sparse = grow_sparse_array(manager->pools[type].sparse, old_capacity, new_capacity);
+        if (!check_ptr(new_sparse, LOG_LEVEL_ERROR, "Échec d'agrandissement de l'index des composants")) {
+            // Les tableaux déjà agrandis restent valides, seule la capacité commune est conservée
+            return false;
+        }
+        manager->pools[type].sparse = new_sparse;
+    }
+
+    for (int i = 0; i < manager->query_count; i++) {
+        new_sparse = grow_sparse_array(manager->queries[i].sparse, old_capacity, new_capacity);
+        if (!check_ptr(new_sparse, LOG_LEVEL_ERROR, "Échec d'agrandissement de l'index d'une vue")) {
+            return false;
+        }
+        manager->queries[i].sparse = new_sparse;
+    }
+
+    // Générations des index (les nouveaux index commencent à la génération 0)
+    uint16_t* new_generations = (uint16_t*)realloc(manager->entity_generations, new_capacity * sizeof(uint16_t));
+    if (!check_ptr(new_generations, LOG_LEVEL_ERROR, "Échec d'agrandissement des générations d'entités")) {
+        return false;
+    }
+    memset(new_generations + old_capacity, 0, (new_capacity - old_capacity) * sizeof(uint16_t));
+    manager->entity_generations = new_generations;
+
+    // Emplacements dans les archétypes (les nouveaux index n'ont pas de ligne)
+    if (manager->storage_mode == ENTITY_STORAGE_ARCHETYPES) {
+        ArchetypeLocation* new_locations = (ArchetypeLocation*)realloc(
+            manager->entity_locations, new_capacity * sizeof(ArchetypeLocation)
+        );
+        if (!check_ptr(new_locations, LOG_LEVEL_ERROR, "Échec d'agrandissement des emplacements d'archétypes")) {
+            return false;
+        }
+        for (uint32_t i = old_capacity; i < new_capacity; i++) {
+            new_locations[i].archetype = -1;
+            new_locations[i].row = -1;
+        }
+        manager->entity_locations = new_locations;
+    }
+
+    // La pile des index libérés ne peut pas dépasser le nombre d'index
+    uint32_t* new_free = (uint32_t*)realloc(manager->free_indices, new_capacity * sizeof(uint32_t));
+    if (!check_ptr(new_free, LOG_LEVEL_ERROR, "Échec d'agrandissement de la liste des index libres")) {
+        return false;
+    }
+    manager->free_indices = new_free;
+
+    manager->sparse_capacity = new_capacity;
+    return true;
+}
+
+// Ajoute une entité à une vue de requête
+static bool query_insert(EntityQuery* query, EntityID entity_id) {
+    if (query->count >= query->capacity) {
+        int new_capacity = query->capacity ? query->capacity * 2 : 64;
+        EntityID* new_entities = (EntityID*)realloc(query->entities, new_capacity * sizeof(EntityID));
+        if (!check_ptr(new_entities, LOG_LEVEL_ERROR, "Échec d'agrandissement d'une vue de requête")) {
+            return false;
+        }
+        query->entities = new_entities;
+        query->capacity = new_capacity;
+    }
+
+    query->sparse[ENTITY_INDEX(entity_id)] = query->count;
+    query->entities[query->count++] = entity_id;
+    return true;
+}
+
+// Mémorise la sortie d'une entité d'une vue suivie
+static void query_record_removed(EntityQuery* query, EntityID entity_id) {
+    if (!query->track_removed || query->removed_overflow) return;
+
+    if (query->removed_count >= query->removed_capacity) {
+        int new_capacity = query->removed_capacity ? query->removed_capacity * 2 : 64;
+        EntityID* new_removed = (EntityID*)realloc(query->removed, new_capacity * sizeof(EntityID));
+        if (!check_ptr(new_removed, LOG_LEVEL_WARNING, "Échec d'agrandissement des sorties d'une vue")) {
+            // Le consommateur reverra toute la vue
+            query->removed_overflow = true;
+            return;
+        }
+        query->removed = new_removed;
+        query->removed_capacity = new_capacity;
+    }
+
+    query->removed[query->removed_count++] = entity_id;
+}
+
+// Retire une entité d'une vue de requête (la dernière prend sa place)
+static void query_erase(EntityQuery* query, EntityID entity_id) {
+    uint32_t index = ENTITY_INDEX(entity_id);
+    int position = query->sparse[index];
+    if (position < 0) return;
+
+    EntityID moved_id = query->entities[--query->count];
+    query->entities[position] = moved_id;
+    query->sparse[ENTITY_INDEX(moved_id)] = position;
+    query->sparse[index] = -1;
+
+    query_record_removed(query, entity_id);
+}
+
+// Répercute un changement de masque d'une entité sur toutes les vues
+static void update_queries(EntityManager* manager, EntityID entity_id,
+                           ComponentMask old_mask, ComponentMask new_mask) {
+    for (int i = 0; i < manager->query_count; i++) {
+        EntityQuery* query = &manager->queries[i];
+        bool was_matching = (old_mask & query->mask) == query->mask;
+        bool is_matching = (new_mask & query->mask) == query->mask;
+
+        if (!was_matching && is_matching) {
+            query_insert(query, entity_id);
+        } else if (was_matching && !is_matching) {
+            query_erase(query, entity_id);
+        }
+    }
+}
+
+// Libère toute la mémoire dynamique du gestionnaire (sans le gestionnaire lui-même)
+static void release_storage(EntityManager* manager) {
+    for (int i = 0; i < COMPONENT_TYPE_COUNT; i++) {
+        ComponentPool* pool = &manager->pools[i];
+        for (int page = 0; page < pool->page_count; page++) {
+            free(pool->pages[page]);
+            free(pool->tick_pages[page]);
+        }
+        free(pool->pages);
+        free(pool->tick_pages);
+        free(pool->sparse);
+        pool->pages = NULL;
+        pool->tick_pages = NULL;
+        pool->sparse = NULL;
+        pool->page_count = 0;
+        pool->page_capacity = 0;
+        pool->count = 0;
+    }
+
+    for (int i = 0; i < manager->query_count; i++) {
+        free(manager->queries[i].entities);
+        free(manager->queries[i].sparse);
+        free(manager->queries[i].removed);
+        manager->queries[i].entities = NULL;
+        manager->queries[i].sparse = NULL;
+        manager->queries[i].removed = NULL;
+    }
+    manager->query_count = 0;
+
+    archetype_storage_shutdown(manager->archetypes);
+    free(manager->entity_locations);
+    manager->archetypes = NULL;
+    manager->entity_locations = NULL;
+
+    free(manager->entities);
+    free(manager->entity_masks);
+    free(manager->entity_sparse);
+    free(manager->entity_generations);
+    free(manager->free_indices);
+    manager->entities = NULL;
+    manager->entity_masks = NULL;
+    manager->entity_sparse = NULL;
+    manager->entity_generations = NULL;
+    manager->free_indices = NULL;
+}
+
 // Initialise le gestionnaire d'entités
 EntityManager* entity_manager_init(void) {
+    return entity_manager_init_with_storage(ENTITY_STORAGE_POOLS);
+}
+
+// Initialise le gestionnaire d'entités avec un mode de stockage donné
+EntityManager* entity_manager_init_with_storage(EntityStorageMode mode) {
     EntityManager* manager = (EntityManager*)calloc(1, sizeof(EntityManager));
     if (!check_ptr(manager, LOG_LEVEL_ERROR, "Échec d'allocation du gestionnaire d'entités")) {
         return NULL;
     }
 
-    // Initialiser les tableaux de composants
+    // Les pools sont vides : leurs pages seront allouées au fil des ajouts
     for (int i = 0; i < COMPONENT_TYPE_COUNT; i++) {
-        manager->component_arrays[i] = calloc(MAX_COMPONENTS_PER_TYPE, component_sizes[i]);
-        if (!check_ptr(manager->component_arrays[i], LOG_LEVEL_ERROR, \
-                    "Échec d'allocation des tableaux de composants")) {
-            // Libérer les tableaux déjà alloués
-            for (int j = 0; j < i; j++) {
-                free(manager->component_arrays[j]);
-            }
+        manager->pools[i].component_size = component_sizes[i];
+    }
+
+    // Les composants créés avant le premier changement de tick portent le tick 1
+    manager->change_tick = 1;
+
+    // En mode archétypes, les composants vivent dans les chunks et non dans les pools
+    manager->storage_mode = mode;
+    if (mode == ENTITY_STORAGE_ARCHETYPES) {
+        manager->archetypes = archetype_storage_init(component_sizes);
+        if (!manager->archetypes) {
             free(manager);
             return NULL;
         }
-        manager->component_counts[i] = 0;
+    }
+
+    // Allouer les tableaux denses et les index creux des entités et des composants
+    if (!ensure_entity_capacity(manager, INITIAL_ENTITY_CAPACITY) ||
+        !ensure_sparse_capacity(manager, 0)) {
+        release_storage(manager);
+        free(manager);
+        return NULL;
     }
 
     // Initialiser les autres membres
     manager->entity_count = 0;
-    manager->next_entity_id = 1; // Commencer à 1 car 0 est INVALID_ENTITY_ID
+    manager->next_entity_index = 1; // Commencer à 1 car 0 est INVALID_ENTITY_ID
+    manager->free_count = 0;
 
-    log_info("Gestionnaire d'entités initialisé avec succès");
+    log_info("Gestionnaire d'entités initialisé avec succès (stockage : %s)",
+             mode == ENTITY_STORAGE_ARCHETYPES ? "archétypes" : "pools");
     return manager;
 }
 
@@ -53,13 +358,8 @@ EntityManager* entity_manager_init(void) {
 void entity_manager_shutdown(EntityManager* manager) {
     if (!manager) return;
 
-    // Libérer tous les tableaux de composants
-    for (int i = 0; i < COMPONENT_TYPE_COUNT; i++) {
-        if (manager->component_arrays[i]) {
-            free(manager->component_arrays[i]);
-            manager->component_arrays[i] = NULL;
-        }
-    }
+    // Libérer les pools, les tableaux d'entités et les index creux
+    release_storage(manager);
 
     // Libérer le gestionnaire lui-même
     free(manager);
@@ -67,42 +367,216 @@ void entity_manager_shutdown(EntityManager* manager) {
     log_info("Gestionnaire d'entités libéré");
 }
 
-// Crée une nouvelle entité
-EntityID entity_create(EntityManager* manager) {
-    if (!manager) return INVALID_ENTITY_ID;
-
-    if (manager->entity_count >= MAX_ENTITIES) {
-        log_error("Impossible de créer une entité : limite atteinte (%d)", MAX_ENTITIES);
-        return INVALID_ENTITY_ID;
+// Attribue un ID et une place dans la liste des entités (capacité déjà garantie)
+static EntityID allocate_entity(EntityManager* manager) {
+    // Réutiliser un index libéré si possible, sinon en prendre un nouveau
+    uint32_t index;
+    if (manager->free_count > 0) {
+        index = manager->free_indices[--manager->free_count];
+    } else {
+        if (manager->next_entity_index > ENTITY_INDEX_MASK) {
+            log_error("Impossible de créer une entité : plus d'index disponible");
+            return INVALID_ENTITY_ID;
+        }
+        if (!ensure_sparse_capacity(manager, manager->next_entity_index)) {
+            return INVALID_ENTITY_ID;
+        }
+        index = manager->next_entity_index++;
     }
 
-    // Attribuer un nouvel ID
-    EntityID new_id = manager->next_entity_id++;
+    // L'ID combine l'index et sa génération courante
+    EntityID new_id = MAKE_ENTITY_ID(index, manager->entity_generations[index]);
 
     // Ajouter l'ID à la liste des entités
     manager->entities[manager->entity_count] = new_id;
+    manager->entity_sparse[index] = manager->entity_count;
 
     // Initialiser le masque de composants
     manager->entity_masks[manager->entity_count] = 0;
+    if (manager->entity_locations) {
+        manager->entity_locations[index].archetype = -1;
+        manager->entity_locations[index].row = -1;
+    }
 
     // Incrémenter le compteur d'entités
     manager->entity_count++;
 
-    log_debug("Entité créée avec ID %u", new_id);
     return new_id;
 }
 
-// Fonction interne pour trouver l'index d'une entité
+// Crée une nouvelle entité
+EntityID entity_create(EntityManager* manager) {
+    if (!manager) return INVALID_ENTITY_ID;
+
+    if (!ensure_entity_capacity(manager, manager->entity_count + 1)) {
+        return INVALID_ENTITY_ID;
+    }
+
+    EntityID new_id = allocate_entity(manager);
+    if (new_id != INVALID_ENTITY_ID) {
+        log_debug("Entité créée avec ID %u", new_id);
+    }
+    return new_id;
+}
+
+// Fonction interne pour trouver l'index d'une entité (temps constant via l'index creux)
 static int find_entity_index(EntityManager* manager, EntityID entity_id) {
     if (!manager) return -1;
 
-    for (int i = 0; i < manager->entity_count; i++) {
-        if (manager->entities[i] == entity_id) {
-            return i;
+    uint32_t index = ENTITY_INDEX(entity_id);
+    if (index >= manager->sparse_capacity) return -1;
+
+    // Un ID périmé porte une ancienne génération de l'index
+    if (manager->entity_generations[index] != ENTITY_GENERATION(entity_id)) return -1;
+
+    return manager->entity_sparse[index];
+}
+
+// Fonction interne pour trouver l'index d'un composant (temps constant via l'index creux du type)
+static int find_component_index(EntityManager* manager, EntityID entity_id, ComponentType type) {
+    if (!manager) return -1;
+
+    uint32_t index = ENTITY_INDEX(entity_id);
+    if (index >= manager->sparse_capacity || IS_TAG_COMPONENT(type)) return -1;
+
+    return manager->pools[type].sparse[index];
+}
+
+// Réserve l'emplacement d'un composant dans le pool de son type et le met à zéro
+static void* pool_attach(ComponentPool* pool, EntityID entity_id, uint32_t tick) {
+    // Une nouvelle page est allouée si la dernière est pleine
+    if (!pool_reserve_slot(pool)) return NULL;
+
+    void* slot = pool_slot(pool, pool->count);
+    memset(slot, 0, pool->component_size);
+    *pool_tick(pool, pool->count) = tick;
+    pool->sparse[ENTITY_INDEX(entity_id)] = pool->count++;
+    return slot;
+}
+
+// Retire le composant d'une entité de son pool (le dernier composant prend sa place)
+static void pool_detach(ComponentPool* pool, EntityID entity_id) {
+    int component_index = pool->sparse[ENTITY_INDEX(entity_id)];
+    if (component_index < 0) return;
+
+    int last_index = pool->count - 1;
+
+    // Si ce n'est pas le dernier composant, déplacer le dernier à la place de celui-ci
+    if (component_index < last_index) {
+        void* src = pool_slot(pool, last_index);
+        void* dest = pool_slot(pool, component_index);
+        memcpy(dest, src, pool->component_size);
+        *pool_tick(pool, component_index) = *pool_tick(pool, last_index);
+
+        // Le composant déplacé change de position
+        pool->sparse[ENTITY_INDEX(((Component*)dest)->entity)] = component_index;
+    }
+    pool->sparse[ENTITY_INDEX(entity_id)] = -1;
+
+    // Décrémenter le nombre de composants et rendre les pages devenues inutiles
+    pool->count--;
+    pool_trim(pool);
+}
+
+// Déplace une entité d'archétype et met à jour l'emplacement de celle qui comble le trou
+static bool archetype_relocate(EntityManager* manager, EntityID entity_id, int target) {
+    ArchetypeLocation* location = &manager->entity_locations[ENTITY_INDEX(entity_id)];
+    EntityID moved_id = INVALID_ENTITY_ID;
+    int row;
+
+    if (location->archetype < 0) {
+        row = archetype_push_row(manager->archetypes, target, entity_id);
+    } else if (target < 0) {
+        // Plus aucun composant stocké : l'entité quitte les archétypes
+        moved_id = archetype_remove_row(manager->archetypes, location->archetype, location->row);
+        row = -1;
+    } else {
+        row = archetype_move_row(manager->archetypes, location->archetype, location->row, target, &moved_id);
+    }
+
+    if (target >= 0 && row < 0) return false;
+
+    if (moved_id != INVALID_ENTITY_ID) {
+        manager->entity_locations[ENTITY_INDEX(moved_id)].row = location->row;
+    }
+
+    location->archetype = target;
+    location->row = row;
+    return true;
+}
+
+// Crée le stockage d'un composant pour une entité et renvoie son adresse (mise à zéro)
+static void* storage_attach(EntityManager* manager, EntityID entity_id, ComponentType type) {
+    if (manager->storage_mode == ENTITY_STORAGE_POOLS) {
+        return pool_attach(&manager->pools[type], entity_id, manager->change_tick);
+    }
+
+    ArchetypeLocation* location = &manager->entity_locations[ENTITY_INDEX(entity_id)];
+    int target = location->archetype < 0
+        ? archetype_storage_get(manager->archetypes, COMPONENT_BIT(type))
+        : archetype_storage_neighbor(manager->archetypes, location->archetype, type, true);
+    if (target < 0 || !archetype_relocate(manager, entity_id, target)) return NULL;
+
+    uint32_t* tick = archetype_get_tick(manager->archetypes, location->archetype, location->row, type);
+    if (tick) *tick = manager->change_tick;
+    return archetype_get_component(manager->archetypes, location->archetype, location->row, type);
+}
+
+// Supprime le stockage d'un composant d'une entité
+static void storage_detach(EntityManager* manager, EntityID entity_id, ComponentMask mask, ComponentType type) {
+    if (IS_TAG_COMPONENT(type)) return;
+
+    if (manager->storage_mode == ENTITY_STORAGE_POOLS) {
+        pool_detach(&manager->pools[type], entity_id);
+        return;
+    }
+
+    ArchetypeLocation* location = &manager->entity_locations[ENTITY_INDEX(entity_id)];
+    if (location->archetype < 0) return;
+
+    // Les tags ne comptent pas : une entité qui n'a plus que des tags quitte les archétypes
+    int target = (REMOVE_COMPONENT(mask, type) & ~TAG_COMPONENT_MASK) == 0
+        ? -1
+        : archetype_storage_neighbor(manager->archetypes, location->archetype, type, false);
+    archetype_relocate(manager, entity_id, target);
+}
+
+// Supprime d'un coup le stockage de tous les composants d'une entité
+static void storage_release(EntityManager* manager, EntityID entity_id, ComponentMask mask) {
+    if (manager->storage_mode == ENTITY_STORAGE_POOLS) {
+        for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+            if (HAS_COMPONENT(mask, type) && !IS_TAG_COMPONENT(type)) {
+                pool_detach(&manager->pools[type], entity_id);
+            }
         }
+        return;
+    }
+
+    if (manager->entity_locations[ENTITY_INDEX(entity_id)].archetype >= 0) {
+        archetype_relocate(manager, entity_id, -1);
+    }
+}
+
+// Récupère l'adresse du composant d'une entité dans le stockage
+static void* storage_get(EntityManager* manager, EntityID entity_id, ComponentType type) {
+    if (manager->storage_mode == ENTITY_STORAGE_POOLS) {
+        int component_index = find_component_index(manager, entity_id, type);
+        return component_index < 0 ? NULL : pool_slot(&manager->pools[type], component_index);
+    }
+
+    const ArchetypeLocation* location = &manager->entity_locations[ENTITY_INDEX(entity_id)];
+    return archetype_get_component(manager->archetypes, location->archetype, location->row, type);
+}
+
+// Récupère le tick de modification du composant d'une entité dans le stockage
+static uint32_t* storage_tick(EntityManager* manager, EntityID entity_id, ComponentType type) {
+    if (manager->storage_mode == ENTITY_STORAGE_POOLS) {
+        int component_index = find_component_index(manager, entity_id, type);
+        return component_index < 0 ? NULL : pool_tick(&manager->pools[type], component_index);
     }
 
-    return -1;
+    const ArchetypeLocation* location = &manager->entity_locations[ENTITY_INDEX(entity_id)];
+    return archetype_get_tick(manager->archetypes, location->archetype, location->row, type);
 }
 
 // Détruit une entité et tous ses composants
@@ -118,17 +592,28 @@ bool entity_destroy(EntityManager* manager, EntityID entity_id) {
     // Récupérer le masque de composants
     ComponentMask mask = manager->entity_masks[entity_index];
 
-    // Supprimer tous les composants de l'entité
-    for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
-        if (HAS_COMPONENT(mask, type)) {
-            entity_remove_component(manager, entity_id, (ComponentType)type);
-        }
-    }
+    // Supprimer tous les composants de l'entité et la retirer des vues
+    storage_release(manager, entity_id, mask);
+    manager->entity_masks[entity_index] = 0;
+    update_queries(manager, entity_id, mask, 0);
 
     // Remplacer cette entité par la dernière dans la liste pour maintenir un tableau compact
     if (entity_index < manager->entity_count - 1) {
-        manager->entities[entity_index] = manager->entities[manager->entity_count - 1];
+        EntityID moved_id = manager->entities[manager->entity_count - 1];
+        manager->entities[entity_index] = moved_id;
         manager->entity_masks[entity_index] = manager->entity_masks[manager->entity_count - 1];
+        manager->entity_sparse[ENTITY_INDEX(moved_id)] = entity_index;
+    }
+
+    // Libérer l'index : la génération suivante rend les anciens ID invalides
+    uint32_t index = ENTITY_INDEX(entity_id);
+    manager->entity_sparse[index] = -1;
+    manager->entity_generations[index]++;
+    if (manager->entity_generations[index] < ENTITY_PENDING_GENERATION) {
+        manager->free_indices[manager->free_count++] = index;
+    } else {
+        // Génération épuisée : retirer l'index plutôt que de réémettre d'anciens ID
+        log_debug("Index d'entité %u retiré (générations épuisées)", index);
     }
 
     // Décrémenter le compteur d'entités
@@ -143,68 +628,189 @@ bool entity_exists(EntityManager* manager, EntityID entity_id) {
     return find_entity_index(manager, entity_id) != -1;
 }
 
-// Fonction interne pour trouver l'index d'un composant
-static int find_component_index(EntityManager* manager, EntityID entity_id, ComponentType type) {
-    if (!manager) return -1;
+// Crée un composant directement dans le stockage d'une entité
+void* entity_emplace_component(EntityManager* manager, EntityID entity_id, ComponentType type) {
+    if (!manager || entity_id == INVALID_ENTITY_ID) return NULL;
 
-    void* components_array = manager->component_arrays[type];
-    int component_count = manager->component_counts[type];
+    int entity_index = find_entity_index(manager, entity_id);
+    if (entity_index == -1) {
+        log_warning("Tentative d'ajout d'un composant à une entité inexistante (ID: %u)", entity_id);
+        return NULL;
+    }
 
-    for (int i = 0; i < component_count; i++) {
-        // Calculer le pointeur vers le composant
-        Component* component = (Component*)((char*)components_array + i * component_sizes[type]);
+    if (type >= COMPONENT_TYPE_COUNT) {
+        log_error("Type de composant invalide (%d)", type);
+        return NULL;
+    }
 
-        if (component->entity == entity_id) {
-            return i;
-        }
+    if (IS_TAG_COMPONENT(type)) {
+        log_error("Le type %d est un tag sans données : utiliser entity_set_tag", type);
+        return NULL;
     }
 
-    return -1;
+    // Vérifier si l'entité a déjà ce type de composant
+    if (HAS_COMPONENT(manager->entity_masks[entity_index], type)) {
+        log_warning("L'entité %u possède déjà un composant de type %d", entity_id, type);
+        return NULL;
+    }
+
+    // Réserver un emplacement (mis à zéro) dans le stockage
+    Component* dest = (Component*)storage_attach(manager, entity_id, type);
+    if (!dest) {
+        log_error("Impossible de stocker le composant de type %d", type);
+        return NULL;
+    }
+    dest->type = type;
+    dest->entity = entity_id;
+
+    // Mettre à jour le masque de composants de l'entité et les vues concernées
+    ComponentMask old_mask = manager->entity_masks[entity_index];
+    manager->entity_masks[entity_index] = ADD_COMPONENT(old_mask, type);
+    update_queries(manager, entity_id, old_mask, manager->entity_masks[entity_index]);
+
+    log_debug("Composant de type %d ajouté à l'entité %u", type, entity_id);
+    return dest;
 }
 
 // Ajoute un composant à une entité
 bool entity_add_component(EntityManager* manager, EntityID entity_id, void* component) {
     if (!manager || !component || entity_id == INVALID_ENTITY_ID) return false;
 
-    int entity_index = find_entity_index(manager, entity_id);
-    if (entity_index == -1) {
-        log_warning("Tentative d'ajout d'un composant à une entité inexistante (ID: %u)", entity_id);
-        return false;
+    // Réserver l'emplacement puis y copier le composant
+    ComponentType type = ((Component*)component)->type;
+    void* dest = entity_emplace_component(manager, entity_id, type);
+    if (!dest) return false;
+
+    memcpy(dest, component, component_sizes[type]);
+    ((Component*)dest)->entity = entity_id;
+    return true;
+}
+
+// Annule une création en lot en détruisant les entités déjà créées
+static void cancel_batch(EntityManager* manager, EntityID* entity_ids, int created, int count) {
+    for (int i = 0; i < created; i++) {
+        entity_destroy(manager, entity_ids[i]);
+        entity_ids[i] = INVALID_ENTITY_ID;
     }
+    log_error("Échec de la création en lot (%d/%d entités créées)", created, count);
+}
 
-    // Récupérer le type de composant
-    Component* base_component = (Component*)component;
-    ComponentType type = base_component->type;
+// Crée plusieurs entités possédant toutes le même ensemble de composants
+bool entity_create_batch(EntityManager* manager, int count, ComponentMask mask, EntityID* out_ids) {
+    if (!manager || !out_ids || count <= 0) return false;
 
-    // Vérifier si l'entité a déjà ce type de composant
-    if (HAS_COMPONENT(manager->entity_masks[entity_index], type)) {
-        log_warning("L'entité %u possède déjà un composant de type %d", entity_id, type);
+    if ((mask >> COMPONENT_TYPE_COUNT) != 0) {
+        log_error("Masque de composants invalide pour la création en lot (0x%x)", mask);
         return false;
     }
 
-    // Vérifier si on a atteint la limite de composants pour ce type
-    if (manager->component_counts[type] >= MAX_COMPONENTS_PER_TYPE) {
-        log_error("Limite de composants atteinte pour le type %d", type);
+    // Réserver d'un coup la place de toutes les entités
+    if (!ensure_entity_capacity(manager, manager->entity_count + count)) {
         return false;
     }
 
-    // Calculer l'adresse où le composant sera stocké
-    void* dest = (char*)manager->component_arrays[type] + \
-                 manager->component_counts[type] * component_sizes[type];
+    // En mode archétypes, toutes les entités du lot vont dans le même archétype (tags exclus)
+    ComponentMask stored_mask = mask & ~TAG_COMPONENT_MASK;
+    int archetype = -1;
+    if (manager->storage_mode == ENTITY_STORAGE_ARCHETYPES && stored_mask != 0) {
+        archetype = archetype_storage_get(manager->archetypes, stored_mask);
+        if (archetype < 0) return false;
+    }
 
-    // Copier le composant dans le tableau de composants
-    memcpy(dest, component, component_sizes[type]);
+    for (int i = 0; i < count; i++) {
+        EntityID entity_id = allocate_entity(manager);
+        out_ids[i] = entity_id;
+        if (entity_id == INVALID_ENTITY_ID) {
+            cancel_batch(manager, out_ids, i, count);
+            return false;
+        }
 
-    // Mettre à jour le masque de composants de l'entité
-    manager->entity_masks[entity_index] = ADD_COMPONENT(manager->entity_masks[entity_index], type);
+        // Attacher les composants (mis à zéro) et renseigner leur en-tête ; les tags n'ont rien à attacher
+        ComponentMask attached = mask & TAG_COMPONENT_MASK;
+        if (archetype >= 0) {
+            ArchetypeLocation* location = &manager->entity_locations[ENTITY_INDEX(entity_id)];
+            location->row = archetype_push_row(manager->archetypes, archetype, entity_id);
+            if (location->row >= 0) {
+                location->archetype = archetype;
+                attached = mask;
+            }
+        }
 
-    // Incrémenter le nombre de composants
-    manager->component_counts[type]++;
+        for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+            if (!HAS_COMPONENT(stored_mask, type)) continue;
+
+            Component* component;
+            if (archetype >= 0) {
+                if (attached != mask) break;
+                component = (Component*)archetype_get_component(
+                    manager->archetypes, archetype, manager->entity_locations[ENTITY_INDEX(entity_id)].row,
+                    (ComponentType)type
+                );
+                if (!component) continue;
+                *archetype_get_tick(
+                    manager->archetypes, archetype, manager->entity_locations[ENTITY_INDEX(entity_id)].row,
+                    (ComponentType)type
+                ) = manager->change_tick;
+            } else {
+                component = (Component*)pool_attach(&manager->pools[type], entity_id, manager->change_tick);
+                if (!component) continue;
+                attached = ADD_COMPONENT(attached, type);
+            }
 
-    log_debug("Composant de type %d ajouté à l'entité %u", type, entity_id);
+            component->type = (ComponentType)type;
+            component->entity = entity_id;
+        }
+
+        int entity_index = manager->entity_count - 1;
+        manager->entity_masks[entity_index] = attached;
+        update_queries(manager, entity_id, 0, attached);
+
+        if (attached != mask) {
+            cancel_batch(manager, out_ids, i + 1, count);
+            return false;
+        }
+    }
+
+    log_debug("%d entités créées en lot (masque 0x%x)", count, mask);
     return true;
 }
 
+// Récupère une plage contiguë de composants pour une suite d'entités
+int entity_batch_span(EntityManager* manager, const EntityID* entity_ids, int count,
+                      ComponentType type, void** out_span) {
+    if (out_span) *out_span = NULL;
+    if (!manager || !entity_ids || !out_span || count <= 0 || type >= COMPONENT_TYPE_COUNT) return 0;
+
+    size_t size = component_sizes[type];
+    unsigned char* first = (unsigned char*)entity_get_component(manager, entity_ids[0], type);
+    if (!first) return 0;
+
+    // La plage s'arrête à la fin de la page ou du chunk contenant le premier composant
+    int limit;
+    if (manager->storage_mode == ENTITY_STORAGE_POOLS) {
+        int slot = find_component_index(manager, entity_ids[0], type);
+        limit = COMPONENT_PAGE_SIZE - (slot & COMPONENT_PAGE_MASK);
+    } else {
+        const ArchetypeLocation* location = &manager->entity_locations[ENTITY_INDEX(entity_ids[0])];
+        int rows_per_chunk = manager->archetypes->archetypes[location->archetype]->rows_per_chunk;
+        limit = rows_per_chunk - (location->row % rows_per_chunk);
+    }
+    if (limit > count) limit = count;
+
+    // Vérifier que les entités suivantes occupent bien les emplacements consécutifs
+    int span = 1;
+    while (span < limit) {
+        const Component* component = (const Component*)(first + (size_t)span * size);
+        if (component->entity != entity_ids[span] || storage_get(manager, entity_ids[span], type) != component) {
+            break;
+        }
+        span++;
+    }
+
+    *out_span = first;
+    return span;
+}
+
 // Supprime un composant d'une entité
 bool entity_remove_component(EntityManager* manager, EntityID entity_id, ComponentType type) {
     if (!manager || entity_id == INVALID_ENTITY_ID || type >= COMPONENT_TYPE_COUNT) return false;
@@ -221,31 +827,40 @@ bool entity_remove_component(EntityManager* manager, EntityID entity_id, Compone
         return false;
     }
 
-    // Trouver l'index du composant
-    int component_index = find_component_index(manager, entity_id, type);
-    if (component_index == -1) {
-        log_error("Incohérence : composant introuvable pour l'entité %u (type %d)", entity_id, type);
-        return false;
-    }
+    // Libérer le stockage du composant
+    storage_detach(manager, entity_id, manager->entity_masks[entity_index], type);
 
-    // Calculer les adresses des composants
-    void* components_array = manager->component_arrays[type];
-    int component_count = manager->component_counts[type];
+    // Mettre à jour le masque de composants de l'entité et les vues concernées
+    ComponentMask old_mask = manager->entity_masks[entity_index];
+    manager->entity_masks[entity_index] = REMOVE_COMPONENT(old_mask, type);
+    update_queries(manager, entity_id, old_mask, manager->entity_masks[entity_index]);
 
-    // Si ce n'est pas le dernier composant, déplacer le dernier à la place de celui-ci
-    if (component_index < component_count - 1) {
-        void* src = (char*)components_array + (component_count - 1) * component_sizes[type];
-        void* dest = (char*)components_array + component_index * component_sizes[type];
-        memcpy(dest, src, component_sizes[type]);
+    log_debug("Composant de type %d supprimé de l'entité %u", type, entity_id);
+    return true;
+}
+
+// Pose ou retire un tag
+bool entity_set_tag(EntityManager* manager, EntityID entity_id, ComponentType tag, bool present) {
+    if (!manager || entity_id == INVALID_ENTITY_ID || tag >= COMPONENT_TYPE_COUNT) return false;
+
+    if (!IS_TAG_COMPONENT(tag)) {
+        log_error("Le type %d n'est pas un tag", tag);
+        return false;
     }
 
-    // Décrémenter le nombre de composants
-    manager->component_counts[type]--;
+    int entity_index = find_entity_index(manager, entity_id);
+    if (entity_index == -1) {
+        log_warning("Tentative de modifier un tag d'une entité inexistante (ID: %u)", entity_id);
+        return false;
+    }
 
-    // Mettre à jour le masque de composants de l'entité
-    manager->entity_masks[entity_index] = REMOVE_COMPONENT(manager->entity_masks[entity_index], type);
+    // Seuls le masque et les vues changent : aucun déplacement de stockage
+    ComponentMask old_mask = manager->entity_masks[entity_index];
+    ComponentMask new_mask = present ? ADD_COMPONENT(old_mask, tag) : REMOVE_COMPONENT(old_mask, tag);
+    if (new_mask == old_mask) return true;
 
-    log_debug("Composant de type %d supprimé de l'entité %u", type, entity_id);
+    manager->entity_masks[entity_index] = new_mask;
+    update_queries(manager, entity_id, old_mask, new_mask);
     return true;
 }
 
@@ -259,20 +874,17 @@ void* entity_get_component(EntityManager* manager, EntityID entity_id, Component
         return NULL;
     }
 
-    // Vérifier si l'entité possède ce type de composant
-    if (!HAS_COMPONENT(manager->entity_masks[entity_index], type)) {
+    // Vérifier si l'entité possède ce type de composant (un tag n'a pas de données)
+    if (!HAS_COMPONENT(manager->entity_masks[entity_index], type) || IS_TAG_COMPONENT(type)) {
         return NULL;
     }
 
-    // Trouver l'index du composant
-    int component_index = find_component_index(manager, entity_id, type);
-    if (component_index == -1) {
+    // Calculer l'adresse du composant
+    void* component = storage_get(manager, entity_id, type);
+    if (!component) {
         log_error("Incohérence : composant introuvable pour l'entité %u (type %d)", entity_id, type);
-        return NULL;
     }
-
-    // Calculer l'adresse du composant
-    return (char*)manager->component_arrays[type] + component_index * component_sizes[type];
+    return component;
 }
 
 // Vérifie si une entité possède un composant spécifique
@@ -285,6 +897,12 @@ bool entity_has_component(EntityManager* manager, EntityID entity_id, ComponentT
     return HAS_COMPONENT(manager->entity_masks[entity_index], type);
 }
 
+// Taille en octets d'un type de composant
+size_t entity_component_size(ComponentType type) {
+    if (type >= COMPONENT_TYPE_COUNT) return 0;
+    return component_sizes[type];
+}
+
 // Récupère le masque de composants d'une entité
 ComponentMask entity_get_mask(EntityManager* manager, EntityID entity_id) {
     if (!manager || entity_id == INVALID_ENTITY_ID) return 0;
@@ -300,6 +918,16 @@ int entity_find_with_components(EntityManager* manager, ComponentMask mask, \
                                EntityID* out_entities, int max_count) {
     if (!manager || !out_entities || max_count <= 0) return 0;
 
+    // Utiliser une vue enregistrée pour ce masque si elle existe
+    for (int i = 0; i < manager->query_count; i++) {
+        EntityQuery* query = &manager->queries[i];
+        if (query->mask == mask) {
+            int count = query->count < max_count ? query->count : max_count;
+            memcpy(out_entities, query->entities, count * sizeof(EntityID));
+            return count;
+        }
+    }
+
     int found_count = 0;
 
     for (int i = 0; i < manager->entity_count && found_count < max_count; i++) {
@@ -313,3 +941,782 @@ int entity_find_with_components(EntityManager* manager, ComponentMask mask, \
 
     return found_count;
 }
+
+// Enregistre une vue de requête tenue à jour incrémentalement
+EntityQuery* entity_query_register(EntityManager* manager, ComponentMask mask) {
+    if (!manager) return NULL;
+
+    // Une vue sans composant requis ne serait pas maintenue à la création des entités
+    if (mask == 0) {
+        log_warning("Vue de requête refusée : masque vide");
+        return NULL;
+    }
+
+    // Réutiliser une vue existante pour le même masque
+    for (int i = 0; i < manager->query_count; i++) {
+        if (manager->queries[i].mask == mask) {
+            return &manager->queries[i];
+        }
+    }
+
+    if (manager->query_count >= MAX_ENTITY_QUERIES) {
+        log_error("Impossible d'enregistrer la vue : limite atteinte (%d)", MAX_ENTITY_QUERIES);
+        return NULL;
+    }
+
+    EntityQuery* query = &manager->queries[manager->query_count];
+    memset(query, 0, sizeof(EntityQuery));
+    query->mask = mask;
+    query->sparse = grow_sparse_array(NULL, 0, manager->sparse_capacity);
+    if (!check_ptr(query->sparse, LOG_LEVEL_ERROR, "Échec d'allocation de l'index d'une vue")) {
+        return NULL;
+    }
+
+    // Remplir la vue avec les entités existantes (seul parcours complet de sa vie)
+    for (int i = 0; i < manager->entity_count; i++) {
+        if ((manager->entity_masks[i] & mask) == mask &&
+            !query_insert(query, manager->entities[i])) {
+            free(query->entities);
+            free(query->sparse);
+            memset(query, 0, sizeof(EntityQuery));
+            return NULL;
+        }
+    }
+
+    manager->query_count++;
+
+    log_debug("Vue de requête enregistrée (masque 0x%x, %d entités)", mask, query->count);
+    return query;
+}
+
+// Active la mémorisation des entités qui sortent d'une vue
+void entity_query_track_removed(EntityQuery* query) {
+    if (!query) return;
+
+    query->track_removed = true;
+}
+
+// Vide la liste des sorties d'une vue
+void entity_query_clear_removed(EntityQuery* query) {
+    if (!query) return;
+
+    query->removed_count = 0;
+    query->removed_overflow = false;
+}
+
+// Passe au tick suivant
+uint32_t entity_manager_advance_tick(EntityManager* manager) {
+    if (!manager) return 0;
+
+    return ++manager->change_tick;
+}
+
+// Marque le composant d'une entité comme modifié au tick courant
+bool entity_mark_changed(EntityManager* manager, EntityID entity_id, ComponentType type) {
+    if (!manager || type >= COMPONENT_TYPE_COUNT || find_entity_index(manager, entity_id) == -1) return false;
+
+    uint32_t* tick = storage_tick(manager, entity_id, type);
+    if (!tick) return false;
+
+    *tick = manager->change_tick;
+    return true;
+}
+
+// Récupère le tick de dernière modification d'un composant
+uint32_t entity_get_change_tick(EntityManager* manager, EntityID entity_id, ComponentType type) {
+    if (!manager || type >= COMPONENT_TYPE_COUNT || find_entity_index(manager, entity_id) == -1) return 0;
+
+    uint32_t* tick = storage_tick(manager, entity_id, type);
+    return tick ? *tick : 0;
+}
+
+// Trouve les entités dont un composant a été ajouté ou modifié depuis un tick
+int entity_find_changed(EntityManager* manager, ComponentType type, uint32_t since_tick,
+                        EntityID* out_entities, int max_entities) {
+    if (!manager || !out_entities || max_entities <= 0 || type >= COMPONENT_TYPE_COUNT) return 0;
+
+    int found = 0;
+
+    // Mode pools : balayer les ticks du pool, page par page
+    if (manager->storage_mode == ENTITY_STORAGE_POOLS) {
+        ComponentPool* pool = &manager->pools[type];
+        for (int slot = 0; slot < pool->count && found < max_entities; slot++) {
+            if (*pool_tick(pool, slot) >= since_tick) {
+                out_entities[found++] = ((Component*)pool_slot(pool, slot))->entity;
+            }
+        }
+        return found;
+    }
+
+    // Mode archétypes : balayer la colonne de ticks de chaque chunk concerné
+    ArchetypeChunkIterator it;
+    ArchetypeChunkView view;
+    entity_chunk_iter_begin(manager, COMPONENT_BIT(type), &it);
+    while (found < max_entities && entity_chunk_iter_next(manager, &it, &view)) {
+        if (!view.ticks[type]) continue;
+
+        for (int i = 0; i < view.count && found < max_entities; i++) {
+            if (view.ticks[type][i] >= since_tick) {
+                out_entities[found++] = view.entities[i];
+            }
+        }
+    }
+
+    return found;
+}
+
+// Mémorise la position de début de pas des Transform modifiés depuis un tick
+int entity_manager_store_previous_transforms(EntityManager* manager, uint32_t since_tick) {
+    if (!manager) return 0;
+
+    int stored = 0;
+
+    // Mode pools : balayer les ticks du pool des Transform
+    if (manager->storage_mode == ENTITY_STORAGE_POOLS) {
+        ComponentPool* pool = &manager->pools[COMPONENT_TRANSFORM];
+        for (int slot = 0; slot < pool->count; slot++) {
+            if (*pool_tick(pool, slot) < since_tick) continue;
+
+            TransformComponent* transform = (TransformComponent*)pool_slot(pool, slot);
+            transform->previous_x = transform->x;
+            transform->previous_y = transform->y;
+            stored++;
+        }
+        return stored;
+    }
+
+    // Mode archétypes : colonnes de Transform et de ticks de chaque chunk
+    ArchetypeChunkIterator it;
+    ArchetypeChunkView view;
+    entity_chunk_iter_begin(manager, COMPONENT_BIT(COMPONENT_TRANSFORM), &it);
+    while (entity_chunk_iter_next(manager, &it, &view)) {
+        TransformComponent* transforms = (TransformComponent*)view.columns[COMPONENT_TRANSFORM];
+        const uint32_t* ticks = view.ticks[COMPONENT_TRANSFORM];
+
+        for (int i = 0; i < view.count; i++) {
+            if (ticks[i] < since_tick) continue;
+
+            transforms[i].previous_x = transforms[i].x;
+            transforms[i].previous_y = transforms[i].y;
+            stored++;
+        }
+    }
+
+    return stored;
+}
+
+// Prépare le parcours des chunks d'archétypes contenant un ensemble de composants
+void entity_chunk_iter_begin(EntityManager* manager, ComponentMask mask, ArchetypeChunkIterator* iterator) {
+    (void)manager;
+    if (!iterator) return;
+
+    iterator->mask = mask;
+    iterator->archetype = 0;
+    iterator->chunk = 0;
+}
+
+// Passe au chunk suivant
+bool entity_chunk_iter_next(EntityManager* manager, ArchetypeChunkIterator* iterator, ArchetypeChunkView* out_view) {
+    if (!manager || !iterator || !out_view || !manager->archetypes) return false;
+
+    ArchetypeStorage* storage = manager->archetypes;
+    while (iterator->archetype < storage->archetype_count) {
+        Archetype* archetype = storage->archetypes[iterator->archetype];
+
+        // Passer aux archétypes suivants si celui-ci ne convient pas ou est épuisé
+        if ((archetype->mask & iterator->mask) != iterator->mask ||
+            iterator->chunk >= archetype->chunk_count) {
+            iterator->archetype++;
+            iterator->chunk = 0;
+            continue;
+        }
+
+        ArchetypeChunk* chunk = &archetype->chunks[iterator->chunk++];
+        out_view->count = chunk->count;
+        out_view->entities = (const EntityID*)chunk->data;
+        for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+            bool has_column = HAS_COMPONENT(archetype->mask, type) && component_sizes[type] > 0;
+            out_view->columns[type] = has_column ? chunk->data + archetype->column_offsets[type] : NULL;
+            out_view->ticks[type] = has_column ? (const uint32_t*)(chunk->data + archetype->tick_offsets[type]) : NULL;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+// Signature des captures ("ECSS" en petit-boutiste)
+#define SNAPSHOT_MAGIC 0x53534345u
+
+// En-tête d'une capture, suivi des sections dans l'ordre d'écriture
+typedef struct {
+    uint32_t magic;                                  // SNAPSHOT_MAGIC
+    uint32_t version;                                // ENTITY_SNAPSHOT_VERSION
+    uint32_t storage_mode;                           // Mode de stockage du gestionnaire capturé
+    uint32_t component_sizes[COMPONENT_TYPE_COUNT];  // Disposition des composants à la capture
+    uint32_t entity_count;                           // Nombre d'entités actives
+    uint32_t next_entity_index;                      // Prochain index jamais attribué
+    uint32_t free_count;                             // Taille de la pile des index libérés
+    uint32_t change_tick;                            // Tick courant
+    uint64_t total_size;                             // Taille totale de la capture
+} SnapshotHeader;
+
+// Écriture séquentielle d'une capture (sans tampon : mesure seulement la taille)
+typedef struct {
+    unsigned char* data;    // Tampon de destination (NULL pour mesurer)
+    size_t size;            // Octets écrits (ou qui l'auraient été)
+    size_t capacity;        // Taille du tampon
+} SnapshotWriter;
+
+// Lecture séquentielle d'une capture avec contrôle des bornes
+typedef struct {
+    const unsigned char* data;  // Capture
+    size_t size;                // Taille de la capture
+    size_t offset;              // Position de lecture
+} SnapshotReader;
+
+static void snapshot_write(SnapshotWriter* writer, const void* src, size_t size) {
+    if (writer->data && size > 0 && writer->size + size <= writer->capacity) {
+        memcpy(writer->data + writer->size, src, size);
+    }
+    writer->size += size;
+}
+
+// Renvoie l'adresse des size octets suivants, ou NULL si la capture est trop courte
+static const unsigned char* snapshot_read(SnapshotReader* reader, size_t size) {
+    if (size > reader->size - reader->offset) return NULL;
+
+    const unsigned char* data = reader->data + reader->offset;
+    reader->offset += size;
+    return data;
+}
+
+static bool snapshot_read_u32(SnapshotReader* reader, uint32_t* out_value) {
+    const unsigned char* data = snapshot_read(reader, sizeof(uint32_t));
+    if (!data) return false;
+
+    memcpy(out_value, data, sizeof(uint32_t));
+    return true;
+}
+
+// Écrit toutes les sections de la capture
+static void write_snapshot(EntityManager* manager, SnapshotWriter* writer, uint64_t total_size) {
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = ENTITY_SNAPSHOT_VERSION;
+    header.storage_mode = (uint32_t)manager->storage_mode;
+    for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+        header.component_sizes[type] = (uint32_t)component_sizes[type];
+    }
+    header.entity_count = (uint32_t)manager->entity_count;
+    header.next_entity_index = manager->next_entity_index;
+    header.free_count = manager->free_count;
+    header.change_tick = manager->change_tick;
+    header.total_size = total_size;
+    snapshot_write(writer, &header, sizeof(header));
+
+    // Entités : tableaux denses, puis générations des index déjà attribués
+    snapshot_write(writer, manager->entities, manager->entity_count * sizeof(EntityID));
+    snapshot_write(writer, manager->entity_masks, manager->entity_count * sizeof(ComponentMask));
+    snapshot_write(writer, manager->entity_generations, manager->next_entity_index * sizeof(uint16_t));
+    snapshot_write(writer, manager->free_indices, manager->free_count * sizeof(uint32_t));
+
+    // Les index creux ne sont pas écrits : ils se reconstruisent depuis les tableaux denses
+    if (manager->storage_mode == ENTITY_STORAGE_POOLS) {
+        for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+            if (IS_TAG_COMPONENT(type)) continue;
+
+            ComponentPool* pool = &manager->pools[type];
+            uint32_t count = (uint32_t)pool->count;
+            snapshot_write(writer, &count, sizeof(count));
+
+            for (int slot = 0; slot < pool->count; slot += COMPONENT_PAGE_SIZE) {
+                int rows = pool->count - slot < COMPONENT_PAGE_SIZE ? pool->count - slot : COMPONENT_PAGE_SIZE;
+                snapshot_write(writer, pool->pages[slot >> COMPONENT_PAGE_SHIFT], rows * pool->component_size);
+            }
+            for (int slot = 0; slot < pool->count; slot += COMPONENT_PAGE_SIZE) {
+                int rows = pool->count - slot < COMPONENT_PAGE_SIZE ? pool->count - slot : COMPONENT_PAGE_SIZE;
+                snapshot_write(writer, pool->tick_pages[slot >> COMPONENT_PAGE_SHIFT], rows * sizeof(uint32_t));
+            }
+        }
+        return;
+    }
+
+    // Archétypes non vides : masque, nombre d'entités puis chunks entiers
+    ArchetypeStorage* storage = manager->archetypes;
+    uint32_t archetype_count = 0;
+    for (int i = 0; i < storage->archetype_count; i++) {
+        if (storage->archetypes[i]->entity_count > 0) archetype_count++;
+    }
+    snapshot_write(writer, &archetype_count, sizeof(archetype_count));
+
+    for (int i = 0; i < storage->archetype_count; i++) {
+        Archetype* archetype = storage->archetypes[i];
+        if (archetype->entity_count == 0) continue;
+
+        uint32_t mask = archetype->mask;
+        uint32_t count = (uint32_t)archetype->entity_count;
+        snapshot_write(writer, &mask, sizeof(mask));
+        snapshot_write(writer, &count, sizeof(count));
+        for (int c = 0; c < archetype->chunk_count; c++) {
+            snapshot_write(writer, archetype->chunks[c].data, ARCHETYPE_CHUNK_SIZE);
+        }
+    }
+}
+
+// Vérifie qu'un index d'entité lu dans une capture a bien été attribué
+static bool snapshot_index_valid(const SnapshotHeader* header, EntityID entity_id) {
+    uint32_t index = ENTITY_INDEX(entity_id);
+    return index != 0 && index < header->next_entity_index;
+}
+
+// Vérifie qu'un ID lu dans une capture désigne une entité active de la capture
+// dense_of_index associe à chaque index la position de son entité (-1 si aucune)
+static int snapshot_entity_position(const SnapshotHeader* header, const int* dense_of_index,
+                                    const unsigned char* entities, EntityID entity_id) {
+    if (!snapshot_index_valid(header, entity_id)) return -1;
+
+    int position = dense_of_index[ENTITY_INDEX(entity_id)];
+    if (position < 0) return -1;
+
+    EntityID alive;
+    memcpy(&alive, entities + position * sizeof(EntityID), sizeof(EntityID));
+    return alive == entity_id ? position : -1;
+}
+
+// Vérifie les sections d'une capture à l'aide de tableaux de travail indexés par index d'entité
+static bool check_snapshot_sections(EntityManager* manager, const SnapshotHeader* header, SnapshotReader* reader,
+                                    int* dense_of_index, uint32_t* seen) {
+    const unsigned char* entities = snapshot_read(reader, header->entity_count * sizeof(EntityID));
+    const unsigned char* masks = snapshot_read(reader, header->entity_count * sizeof(ComponentMask));
+    const unsigned char* generations = snapshot_read(reader, header->next_entity_index * sizeof(uint16_t));
+    if (!entities || !masks || !generations) return false;
+
+    // Entités : index attribué, unique, et génération conforme à la table des générations
+    for (uint32_t i = 0; i < header->entity_count; i++) {
+        EntityID entity_id;
+        ComponentMask mask;
+        uint16_t generation;
+        memcpy(&entity_id, entities + i * sizeof(EntityID), sizeof(EntityID));
+        memcpy(&mask, masks + i * sizeof(ComponentMask), sizeof(ComponentMask));
+        if (!snapshot_index_valid(header, entity_id) || (mask >> COMPONENT_TYPE_COUNT) != 0) return false;
+
+        uint32_t index = ENTITY_INDEX(entity_id);
+        memcpy(&generation, generations + index * sizeof(uint16_t), sizeof(uint16_t));
+        if (dense_of_index[index] >= 0 || generation != ENTITY_GENERATION(entity_id)) return false;
+        dense_of_index[index] = (int)i;
+    }
+
+    // Index libérés : attribués, uniques et sans entité active
+    const unsigned char* free_indices = snapshot_read(reader, header->free_count * sizeof(uint32_t));
+    if (!free_indices) return false;
+    for (uint32_t i = 0; i < header->free_count; i++) {
+        uint32_t index;
+        memcpy(&index, free_indices + i * sizeof(uint32_t), sizeof(uint32_t));
+        if (index == 0 || index >= header->next_entity_index || dense_of_index[index] >= 0 ||
+            seen[index] == UINT32_MAX) {
+            return false;
+        }
+        seen[index] = UINT32_MAX;
+    }
+    memset(seen, 0, header->next_entity_index * sizeof(uint32_t));
+
+    if (manager->storage_mode == ENTITY_STORAGE_POOLS) {
+        for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+            if (IS_TAG_COMPONENT(type)) continue;
+
+            uint32_t count;
+            if (!snapshot_read_u32(reader, &count) || count > header->entity_count) return false;
+
+            const unsigned char* components = snapshot_read(reader, count * component_sizes[type]);
+            if (!components || !snapshot_read(reader, count * sizeof(uint32_t))) return false;
+
+            // Chaque composant appartient à une entité active qui porte ce type, une seule fois
+            uint32_t stamp = (uint32_t)type + 1;
+            for (uint32_t i = 0; i < count; i++) {
+                Component component;
+                memcpy(&component, components + i * component_sizes[type], sizeof(Component));
+
+                int position = snapshot_entity_position(header, dense_of_index, entities, component.entity);
+                if (position < 0 || seen[ENTITY_INDEX(component.entity)] == stamp) return false;
+                seen[ENTITY_INDEX(component.entity)] = stamp;
+
+                ComponentMask mask;
+                memcpy(&mask, masks + position * sizeof(ComponentMask), sizeof(ComponentMask));
+                if (!HAS_COMPONENT(mask, type)) return false;
+            }
+
+            // Sans doublon, le compte garantit que chaque entité portant ce type a son composant
+            uint32_t expected = 0;
+            for (uint32_t i = 0; i < header->entity_count; i++) {
+                ComponentMask mask;
+                memcpy(&mask, masks + i * sizeof(ComponentMask), sizeof(ComponentMask));
+                if (HAS_COMPONENT(mask, type)) expected++;
+            }
+            if (count != expected) return false;
+        }
+        return reader->offset == reader->size;
+    }
+
+    uint32_t archetype_count;
+    if (!snapshot_read_u32(reader, &archetype_count) || archetype_count > header->entity_count) return false;
+
+    // Les masques des archétypes déjà lus sont relus depuis la capture pour détecter les doublons
+    size_t* archetype_offsets = (size_t*)malloc((archetype_count ? archetype_count : 1) * sizeof(size_t));
+    if (!check_ptr(archetype_offsets, LOG_LEVEL_ERROR, "Échec d'allocation pour la vérification d'une capture")) {
+        return false;
+    }
+
+    uint32_t stored_entities = 0;
+    for (uint32_t i = 0; i < archetype_count; i++) {
+        archetype_offsets[i] = reader->offset;
+
+        uint32_t mask, count;
+        if (!snapshot_read_u32(reader, &mask) || !snapshot_read_u32(reader, &count) ||
+            mask == 0 || (mask >> COMPONENT_TYPE_COUNT) != 0 || (mask & TAG_COMPONENT_MASK) != 0 ||
+            count == 0 || count > header->entity_count) {
+            free(archetype_offsets);
+            return false;
+        }
+
+        for (uint32_t j = 0; j < i; j++) {
+            uint32_t previous_mask;
+            memcpy(&previous_mask, reader->data + archetype_offsets[j], sizeof(uint32_t));
+            if (previous_mask == mask) {
+                free(archetype_offsets);
+                return false;
+            }
+        }
+
+        // La disposition d'un chunk ne dépend que du masque et des tailles (déjà vérifiées) :
+        // la calculer sans créer l'archétype, une capture rejetée ne modifie rien
+        int rows = archetype_layout_rows(manager->archetypes, mask);
+        size_t chunk_count = rows > 0 ? (count + rows - 1) / rows : 0;
+        const unsigned char* chunks = rows > 0 ? snapshot_read(reader, chunk_count * ARCHETYPE_CHUNK_SIZE) : NULL;
+        if (!chunks) {
+            free(archetype_offsets);
+            return false;
+        }
+
+        // Chaque ligne désigne une entité active, rangée une seule fois, dont le masque est celui de l'archétype
+        for (uint32_t row = 0; row < count; row++) {
+            EntityID entity_id;
+            memcpy(&entity_id, chunks + (row / rows) * ARCHETYPE_CHUNK_SIZE + (row % rows) * sizeof(EntityID),
+                   sizeof(EntityID));
+
+            int position = snapshot_entity_position(header, dense_of_index, entities, entity_id);
+            if (position < 0 || seen[ENTITY_INDEX(entity_id)] != 0) {
+                free(archetype_offsets);
+                return false;
+            }
+            seen[ENTITY_INDEX(entity_id)] = 1;
+
+            ComponentMask entity_mask;
+            memcpy(&entity_mask, masks + position * sizeof(ComponentMask), sizeof(ComponentMask));
+            if ((entity_mask & ~TAG_COMPONENT_MASK) != mask) {
+                free(archetype_offsets);
+                return false;
+            }
+        }
+        stored_entities += count;
+    }
+    free(archetype_offsets);
+
+    // Toute entité portant au moins un composant stocké doit avoir été rangée
+    uint32_t expected = 0;
+    for (uint32_t i = 0; i < header->entity_count; i++) {
+        ComponentMask mask;
+        memcpy(&mask, masks + i * sizeof(ComponentMask), sizeof(ComponentMask));
+        if ((mask & ~TAG_COMPONENT_MASK) != 0) expected++;
+    }
+    return stored_entities == expected && reader->offset == reader->size;
+}
+
+// Parcourt les sections d'une capture sans rien modifier et vérifie leur cohérence
+static bool check_snapshot(EntityManager* manager, const SnapshotHeader* header, SnapshotReader* reader) {
+    int* dense_of_index = (int*)malloc(header->next_entity_index * sizeof(int));
+    uint32_t* seen = (uint32_t*)calloc(header->next_entity_index, sizeof(uint32_t));
+    if (!check_ptr(dense_of_index, LOG_LEVEL_ERROR, "Échec d'allocation pour la vérification d'une capture") ||
+        !check_ptr(seen, LOG_LEVEL_ERROR, "Échec d'allocation pour la vérification d'une capture")) {
+        free(dense_of_index);
+        free(seen);
+        return false;
+    }
+    for (uint32_t i = 0; i < header->next_entity_index; i++) {
+        dense_of_index[i] = -1;
+    }
+
+    bool valid = check_snapshot_sections(manager, header, reader, dense_of_index, seen);
+
+    free(dense_of_index);
+    free(seen);
+    return valid;
+}
+
+// Fixe le nombre de composants d'un pool en allouant ou libérant des pages
+static bool pool_resize(ComponentPool* pool, int count) {
+    while (pool->page_count * COMPONENT_PAGE_SIZE < count) {
+        pool->count = pool->page_count * COMPONENT_PAGE_SIZE;
+        if (!pool_reserve_slot(pool)) return false;
+    }
+
+    pool->count = count;
+    pool_trim(pool);
+    return true;
+}
+
+// Recalcule le contenu d'une vue à partir des masques
+static bool query_rebuild(EntityManager* manager, EntityQuery* query) {
+    for (uint32_t i = 0; i < manager->sparse_capacity; i++) {
+        query->sparse[i] = -1;
+    }
+    query->count = 0;
+
+    // Les sorties ne sont pas énumérées : le consommateur reverra toute la vue
+    if (query->track_removed) {
+        query->removed_count = 0;
+        query->removed_overflow = true;
+    }
+
+    for (int i = 0; i < manager->entity_count; i++) {
+        if ((manager->entity_masks[i] & query->mask) == query->mask &&
+            !query_insert(query, manager->entities[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Vide le gestionnaire (état laissé par une restauration interrompue)
+static void clear_contents(EntityManager* manager) {
+    manager->entity_count = 0;
+    manager->next_entity_index = 1;
+    manager->free_count = 0;
+    memset(manager->entity_generations, 0, manager->sparse_capacity * sizeof(uint16_t));
+    for (uint32_t i = 0; i < manager->sparse_capacity; i++) {
+        manager->entity_sparse[i] = -1;
+    }
+
+    for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+        if (IS_TAG_COMPONENT(type)) continue;
+
+        pool_resize(&manager->pools[type], 0);
+        for (uint32_t i = 0; i < manager->sparse_capacity; i++) {
+            manager->pools[type].sparse[i] = -1;
+        }
+    }
+
+    if (manager->archetypes) {
+        for (int i = 0; i < manager->archetypes->archetype_count; i++) {
+            archetype_resize(manager->archetypes, i, 0);
+        }
+        for (uint32_t i = 0; i < manager->sparse_capacity; i++) {
+            manager->entity_locations[i].archetype = -1;
+            manager->entity_locations[i].row = -1;
+        }
+    }
+
+    for (int i = 0; i < manager->query_count; i++) {
+        query_rebuild(manager, &manager->queries[i]);
+    }
+}
+
+// Applique une capture déjà vérifiée
+static bool apply_snapshot(EntityManager* manager, const SnapshotHeader* header, SnapshotReader* reader) {
+    if (!ensure_entity_capacity(manager, (int)header->entity_count) ||
+        !ensure_sparse_capacity(manager, header->next_entity_index)) {
+        return false;
+    }
+
+    // Entités, masques et générations : copies directes
+    int entity_count = (int)header->entity_count;
+    const unsigned char* entities = snapshot_read(reader, entity_count * sizeof(EntityID));
+    const unsigned char* masks = snapshot_read(reader, entity_count * sizeof(ComponentMask));
+    const unsigned char* generations = snapshot_read(reader, header->next_entity_index * sizeof(uint16_t));
+    const unsigned char* free_indices = snapshot_read(reader, header->free_count * sizeof(uint32_t));
+    if (!entities || !masks || !generations || !free_indices) return false;
+
+    memcpy(manager->entities, entities, entity_count * sizeof(EntityID));
+    memcpy(manager->entity_masks, masks, entity_count * sizeof(ComponentMask));
+    memcpy(manager->entity_generations, generations, header->next_entity_index * sizeof(uint16_t));
+    memset(manager->entity_generations + header->next_entity_index, 0,
+           (manager->sparse_capacity - header->next_entity_index) * sizeof(uint16_t));
+    memcpy(manager->free_indices, free_indices, header->free_count * sizeof(uint32_t));
+
+    manager->entity_count = entity_count;
+    manager->next_entity_index = header->next_entity_index;
+    manager->free_count = header->free_count;
+    manager->change_tick = header->change_tick;
+
+    for (uint32_t i = 0; i < manager->sparse_capacity; i++) {
+        manager->entity_sparse[i] = -1;
+    }
+    for (int i = 0; i < entity_count; i++) {
+        manager->entity_sparse[ENTITY_INDEX(manager->entities[i])] = i;
+    }
+
+    if (manager->storage_mode == ENTITY_STORAGE_POOLS) {
+        for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+            if (IS_TAG_COMPONENT(type)) continue;
+
+            ComponentPool* pool = &manager->pools[type];
+            uint32_t count;
+            if (!snapshot_read_u32(reader, &count)) return false;
+
+            // Composants puis ticks, une page à la fois
+            const unsigned char* components = snapshot_read(reader, count * pool->component_size);
+            const unsigned char* ticks = snapshot_read(reader, count * sizeof(uint32_t));
+            if (!components || !ticks || !pool_resize(pool, (int)count)) return false;
+            for (int slot = 0; slot < pool->count; slot += COMPONENT_PAGE_SIZE) {
+                int rows = pool->count - slot < COMPONENT_PAGE_SIZE ? pool->count - slot : COMPONENT_PAGE_SIZE;
+                memcpy(pool->pages[slot >> COMPONENT_PAGE_SHIFT], components + slot * pool->component_size,
+                       rows * pool->component_size);
+                memcpy(pool->tick_pages[slot >> COMPONENT_PAGE_SHIFT], ticks + slot * sizeof(uint32_t),
+                       rows * sizeof(uint32_t));
+            }
+
+            for (uint32_t i = 0; i < manager->sparse_capacity; i++) {
+                pool->sparse[i] = -1;
+            }
+            for (int slot = 0; slot < pool->count; slot++) {
+                pool->sparse[ENTITY_INDEX(((Component*)pool_slot(pool, slot))->entity)] = slot;
+            }
+        }
+        return true;
+    }
+
+    // Archétypes : les chunks sont recopiés tels quels, les emplacements recalculés
+    ArchetypeStorage* storage = manager->archetypes;
+    for (uint32_t i = 0; i < manager->sparse_capacity; i++) {
+        manager->entity_locations[i].archetype = -1;
+        manager->entity_locations[i].row = -1;
+    }
+
+    uint32_t archetype_count;
+    if (!snapshot_read_u32(reader, &archetype_count)) return false;
+
+    // Chaque archétype de la capture existe déjà ou est créé ci-dessous
+    bool* restored = (bool*)calloc(storage->archetype_count + archetype_count, sizeof(bool));
+    if (!check_ptr(restored, LOG_LEVEL_ERROR, "Échec d'allocation pour la restauration des archétypes")) {
+        return false;
+    }
+    for (uint32_t i = 0; i < archetype_count; i++) {
+        uint32_t mask, count;
+        if (!snapshot_read_u32(reader, &mask) || !snapshot_read_u32(reader, &count)) {
+            free(restored);
+            return false;
+        }
+
+        // Masques déjà vérifiés : les archétypes manquants sont créés maintenant
+        int index = archetype_storage_get(storage, mask);
+        if (index < 0 || !archetype_resize(storage, index, (int)count)) {
+            free(restored);
+            return false;
+        }
+        restored[index] = true;
+
+        Archetype* archetype = storage->archetypes[index];
+        for (int c = 0; c < archetype->chunk_count; c++) {
+            const unsigned char* chunk = snapshot_read(reader, ARCHETYPE_CHUNK_SIZE);
+            if (!chunk) {
+                free(restored);
+                return false;
+            }
+            memcpy(archetype->chunks[c].data, chunk, ARCHETYPE_CHUNK_SIZE);
+        }
+        for (int row = 0; row < archetype->entity_count; row++) {
+            ArchetypeLocation* location =
+                &manager->entity_locations[ENTITY_INDEX(archetype_get_entity(storage, index, row))];
+            location->archetype = index;
+            location->row = row;
+        }
+    }
+
+    // Les archétypes absents de la capture sont vidés
+    for (int i = 0; i < storage->archetype_count; i++) {
+        if (!restored[i]) archetype_resize(storage, i, 0);
+    }
+    free(restored);
+    return true;
+}
+
+// Calcule la taille de la capture complète du gestionnaire
+size_t entity_manager_snapshot_size(EntityManager* manager) {
+    if (!manager) return 0;
+
+    SnapshotWriter writer = { NULL, 0, 0 };
+    write_snapshot(manager, &writer, 0);
+    return writer.size;
+}
+
+// Écrit l'état complet du gestionnaire dans un bloc contigu
+size_t entity_manager_snapshot(EntityManager* manager, void* buffer, size_t capacity) {
+    if (!manager || !buffer) return 0;
+
+    size_t size = entity_manager_snapshot_size(manager);
+    if (size > capacity) {
+        log_error("Tampon de capture trop petit (%zu octets, %zu requis)", capacity, size);
+        return 0;
+    }
+
+    SnapshotWriter writer = { (unsigned char*)buffer, 0, capacity };
+    write_snapshot(manager, &writer, size);
+
+    log_debug("Capture du gestionnaire : %d entités, %zu octets", manager->entity_count, size);
+    return size;
+}
+
+// Restaure l'état du gestionnaire depuis une capture
+bool entity_manager_restore(EntityManager* manager, const void* buffer, size_t size) {
+    if (!manager || !buffer || size < sizeof(SnapshotHeader)) return false;
+
+    SnapshotHeader header;
+    memcpy(&header, buffer, sizeof(header));
+
+    if (header.magic != SNAPSHOT_MAGIC || header.version != ENTITY_SNAPSHOT_VERSION) {
+        log_error("Capture invalide ou de version non prise en charge (version %u)", header.version);
+        return false;
+    }
+    if (header.storage_mode != (uint32_t)manager->storage_mode) {
+        log_error("Capture d'un autre mode de stockage que celui du gestionnaire");
+        return false;
+    }
+    for (int type = 0; type < COMPONENT_TYPE_COUNT; type++) {
+        if (header.component_sizes[type] != (uint32_t)component_sizes[type]) {
+            log_error("Capture incompatible : taille du composant %d modifiée", type);
+            return false;
+        }
+    }
+    if (header.total_size != size || header.next_entity_index == 0 ||
+        header.next_entity_index > ENTITY_INDEX_MASK + 1 ||
+        header.entity_count >= header.next_entity_index || header.free_count >= header.next_entity_index) {
+        log_error("Capture corrompue (en-tête incohérent)");
+        return false;
+    }
+
+    // Vérifier toutes les sections avant de toucher au gestionnaire
+    SnapshotReader reader = { (const unsigned char*)buffer, size, sizeof(header) };
+    if (!check_snapshot(manager, &header, &reader)) {
+        log_error("Capture corrompue (sections incohérentes)");
+        return false;
+    }
+
+    reader.offset = sizeof(header);
+    if (!apply_snapshot(manager, &header, &reader)) {
+        log_error("Échec de la restauration : gestionnaire vidé");
+        clear_contents(manager);
+        return false;
+    }
+
+    for (int i = 0; i < manager->query_count; i++) {
+        if (!query_rebuild(manager, &manager->queries[i])) {
+            log_error("Échec de la reconstruction d'une vue après restauration");
+            clear_contents(manager);
+            return false;
+        }
+    }
+
+    log_debug("Gestionnaire restauré : %d entités", manager->entity_count);
+    return true;
+}
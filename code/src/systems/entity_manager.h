@@ -6,39 +6,133 @@
 #ifndef ENTITY_MANAGER_H
 #define ENTITY_MANAGER_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include "../core/entity.h"
+#include "../systems/archetype.h"
 
-// Nombre maximum d'entités gérées simultanément
-#define MAX_ENTITIES 1000
+// Nombre de composants par page de stockage (puissance de 2)
+#define COMPONENT_PAGE_SHIFT 8
+#define COMPONENT_PAGE_SIZE (1 << COMPONENT_PAGE_SHIFT)
+#define COMPONENT_PAGE_MASK (COMPONENT_PAGE_SIZE - 1)
 
-// Nombre maximum de composants par type
-#define MAX_COMPONENTS_PER_TYPE 1000
+// Pool de composants d'un type, stocké par pages de taille fixe.
+// Les pages ne sont jamais déplacées : agrandir le pool n'invalide pas
+// les pointeurs vers les composants existants.
+typedef struct {
+    void** pages;            // Pages de COMPONENT_PAGE_SIZE composants
+    uint32_t** tick_pages;   // Tick de modification de chaque emplacement (pages parallèles)
+    int page_count;          // Nombre de pages allouées
+    int page_capacity;       // Taille du tableau de pages
+    int count;               // Nombre de composants actifs
+    size_t component_size;   // Taille d'un composant en octets
+    int* sparse;             // Index d'entité -> position du composant (-1 si absent)
+} ComponentPool;
+
+// Mode de stockage des composants
+typedef enum {
+    ENTITY_STORAGE_POOLS,       // Un pool paginé par type de composant (par défaut)
+    ENTITY_STORAGE_ARCHETYPES   // Entités de même masque regroupées en chunks de 16 Ko (colonnes SoA)
+} EntityStorageMode;
+
+// Version du format des captures (à incrémenter à chaque changement de disposition)
+#define ENTITY_SNAPSHOT_VERSION 1
+
+// Nombre maximum de vues de requête enregistrées
+#define MAX_ENTITY_QUERIES 32
+
+// Vue de requête : liste dense des entités possédant tous les composants d'un masque.
+// Elle est tenue à jour à chaque ajout ou suppression de composant, les systèmes
+// peuvent donc parcourir entities[0..count) sans rescanner les masques.
+typedef struct {
+    ComponentMask mask;      // Composants requis
+    EntityID* entities;      // Entités correspondantes (ordre non garanti)
+    int count;               // Nombre d'entités dans la vue
+    int capacity;            // Taille allouée du tableau entities
+    int* sparse;             // Index d'entité -> position dans la vue (-1 si absente)
+
+    // Sorties de la vue, pour les consommateurs incrémentaux (voir entity_query_track_removed)
+    EntityID* removed;       // Entités sorties depuis le dernier entity_query_clear_removed
+    int removed_count;       // Nombre d'entités sorties
+    int removed_capacity;    // Taille allouée du tableau removed
+    bool track_removed;      // Les sorties sont mémorisées
+    bool removed_overflow;   // Des sorties ont été perdues (mémoire, reconstruction) : tout revoir
+} EntityQuery;
 
 // Structure de gestion des entités
 typedef struct {
     // Liste des ID d'entités utilisés
-    EntityID entities[MAX_ENTITIES];
+    EntityID* entities;
     // Masques de composants pour chaque entité
-    ComponentMask entity_masks[MAX_ENTITIES];
+    ComponentMask* entity_masks;
     // Nombre d'entités actives
     int entity_count;
-    // Prochain ID d'entité à attribuer
-    EntityID next_entity_id;
+    // Taille allouée des tableaux entities et entity_masks
+    int entity_capacity;
+    // Prochain index d'entité jamais attribué
+    uint32_t next_entity_index;
+
+    // Index creux : index d'entité -> position dans entities[] (-1 si absente)
+    int* entity_sparse;
+    // Génération courante de chaque index d'entité
+    uint16_t* entity_generations;
+    // Pile des index libérés, réutilisés avant d'en créer de nouveaux
+    uint32_t* free_indices;
+    // Nombre d'index dans la pile des index libérés
+    uint32_t free_count;
+    // Nombre d'emplacements alloués dans les index creux (entités et composants)
+    uint32_t sparse_capacity;
+
+    // Pools de composants par type
+    ComponentPool pools[COMPONENT_TYPE_COUNT];
 
-    // Tableaux de composants par type
-    void* component_arrays[COMPONENT_TYPE_COUNT];
-    // Nombre de composants par type
-    int component_counts[COMPONENT_TYPE_COUNT];
+    // Vues de requête enregistrées
+    EntityQuery queries[MAX_ENTITY_QUERIES];
+    // Nombre de vues enregistrées
+    int query_count;
+
+    // Mode de stockage choisi à l'initialisation
+    EntityStorageMode storage_mode;
+    // Stockage par archétypes (NULL en mode pools)
+    ArchetypeStorage* archetypes;
+    // Emplacement de chaque index d'entité dans les archétypes (NULL en mode pools)
+    ArchetypeLocation* entity_locations;
+
+    // Tick courant : les composants ajoutés ou marqués modifiés reçoivent cette valeur
+    uint32_t change_tick;
 } EntityManager;
 
+// Vue sur un chunk d'archétype : colonnes contiguës de composants
+typedef struct {
+    int count;                                // Nombre d'entités dans le chunk
+    const EntityID* entities;                 // Colonne des ID d'entités
+    void* columns[COMPONENT_TYPE_COUNT];      // Colonnes de composants (NULL si absentes)
+    const uint32_t* ticks[COMPONENT_TYPE_COUNT]; // Ticks de modification de chaque colonne
+} ArchetypeChunkView;
+
+// Itérateur sur les chunks des archétypes correspondant à un masque
+typedef struct {
+    ComponentMask mask;     // Composants requis
+    int archetype;          // Archétype courant
+    int chunk;              // Prochain chunk à visiter dans l'archétype courant
+} ArchetypeChunkIterator;
+
 /**
  * Initialise le gestionnaire d'entités
  * @return Pointeur vers le gestionnaire initialisé ou NULL en cas d'erreur
  */
 EntityManager* entity_manager_init(void);
 
+/**
+ * Initialise le gestionnaire d'entités avec un mode de stockage donné
+ * En mode archétypes, ajouter ou retirer un composant déplace tous les composants
+ * de l'entité : les pointeurs obtenus auparavant ne sont plus valides.
+ * @param mode Mode de stockage des composants
+ * @return Pointeur vers le gestionnaire initialisé ou NULL en cas d'erreur
+ */
+EntityManager* entity_manager_init_with_storage(EntityStorageMode mode);
+
 /**
  * Libère les ressources du gestionnaire d'entités
  * @param manager Gestionnaire d'entités à libérer
@@ -52,6 +146,32 @@ void entity_manager_shutdown(EntityManager* manager);
  */
 EntityID entity_create(EntityManager* manager);
 
+/**
+ * Crée plusieurs entités possédant toutes le même ensemble de composants
+ * Les composants sont mis à zéro avec leur en-tête renseigné ; les remplir ensuite
+ * par plages contiguës avec entity_batch_span. En cas d'échec, aucune entité n'est créée.
+ * @param manager Gestionnaire d'entités
+ * @param count Nombre d'entités à créer
+ * @param mask Composants à attacher à chaque entité
+ * @param out_ids Tableau d'au moins count éléments recevant les ID créés
+ * @return true si toutes les entités ont été créées, false sinon
+ */
+bool entity_create_batch(EntityManager* manager, int count, ComponentMask mask, EntityID* out_ids);
+
+/**
+ * Récupère une plage contiguë de composants d'un type pour une suite d'entités
+ * La plage commence au composant de entity_ids[0] et s'arrête à la fin de sa page
+ * (ou de son chunk d'archétype), ou dès qu'une entité n'occupe pas l'emplacement suivant.
+ * @param manager Gestionnaire d'entités
+ * @param entity_ids Suite d'entités (typiquement le résultat de entity_create_batch)
+ * @param count Nombre d'entités de la suite
+ * @param type Type de composant
+ * @param out_span Reçoit l'adresse du premier composant (tableau de composants du type)
+ * @return Nombre d'entités couvertes par la plage (0 si la première n'a pas ce composant)
+ */
+int entity_batch_span(EntityManager* manager, const EntityID* entity_ids, int count,
+                      ComponentType type, void** out_span);
+
 /**
  * Détruit une entité et tous ses composants
  * @param manager Gestionnaire d'entités
@@ -77,6 +197,18 @@ bool entity_exists(EntityManager* manager, EntityID entity_id);
  */
 bool entity_add_component(EntityManager* manager, EntityID entity_id, void* component);
 
+/**
+ * Crée un composant directement dans le stockage, sans allocation ni copie
+ * Le composant est mis à zéro avec son en-tête renseigné ; l'initialiser ensuite
+ * avec la fonction init_*_component correspondante. Comme pour entity_get_component,
+ * le pointeur n'est plus valide après un autre ajout ou retrait de composant.
+ * @param manager Gestionnaire d'entités
+ * @param entity_id ID de l'entité
+ * @param type Type de composant à créer
+ * @return Pointeur vers le composant dans le stockage ou NULL en cas d'erreur
+ */
+void* entity_emplace_component(EntityManager* manager, EntityID entity_id, ComponentType type);
+
 /**
  * Supprime un composant d'une entité
  * @param manager Gestionnaire d'entités
@@ -86,6 +218,18 @@ bool entity_add_component(EntityManager* manager, EntityID entity_id, void* comp
  */
 bool entity_remove_component(EntityManager* manager, EntityID entity_id, ComponentType component_type);
 
+/**
+ * Pose ou retire un tag (composant sans données, voir TAG_COMPONENT_MASK)
+ * Seul le masque de l'entité change : aucun stockage n'est touché, et poser un tag
+ * déjà présent (ou retirer un tag absent) n'est pas une erreur.
+ * @param manager Gestionnaire d'entités
+ * @param entity_id ID de l'entité
+ * @param tag Type de tag
+ * @param present true pour poser le tag, false pour le retirer
+ * @return true si l'entité porte (ou ne porte plus) le tag, false en cas d'erreur
+ */
+bool entity_set_tag(EntityManager* manager, EntityID entity_id, ComponentType tag, bool present);
+
 /**
  * Récupère un composant d'une entité
  * @param manager Gestionnaire d'entités
@@ -104,6 +248,13 @@ void* entity_get_component(EntityManager* manager, EntityID entity_id, Component
  */
 bool entity_has_component(EntityManager* manager, EntityID entity_id, ComponentType component_type);
 
+/**
+ * Taille en octets d'un type de composant
+ * @param type Type de composant
+ * @return Taille du composant ou 0 si le type est invalide
+ */
+size_t entity_component_size(ComponentType type);
+
 /**
  * Récupère le masque de composants d'une entité
  * @param manager Gestionnaire d'entités
@@ -123,4 +274,132 @@ ComponentMask entity_get_mask(EntityManager* manager, EntityID entity_id);
 int entity_find_with_components(EntityManager* manager, ComponentMask mask, \
                                EntityID* out_entities, int max_count);
 
+/**
+ * Enregistre une vue de requête tenue à jour incrémentalement
+ * Si une vue existe déjà pour ce masque, elle est réutilisée.
+ * La vue reste valide jusqu'à la libération du gestionnaire.
+ * @param manager Gestionnaire d'entités
+ * @param mask Masque de composants requis
+ * @return Pointeur vers la vue ou NULL en cas d'erreur
+ */
+EntityQuery* entity_query_register(EntityManager* manager, ComponentMask mask);
+
+/**
+ * Active la mémorisation des entités qui sortent d'une vue (composant retiré, entité détruite)
+ * Les sorties s'accumulent dans removed jusqu'à entity_query_clear_removed. Si removed_overflow
+ * est levé, la liste est incomplète et le consommateur doit comparer son état à toute la vue.
+ * Une vue étant partagée entre tous ceux qui l'enregistrent, un seul consommateur doit la vider.
+ * @param query Vue de requête
+ */
+void entity_query_track_removed(EntityQuery* query);
+
+/**
+ * Vide la liste des sorties d'une vue une fois traitées (et baisse removed_overflow)
+ * @param query Vue de requête
+ */
+void entity_query_clear_removed(EntityQuery* query);
+
+/**
+ * Passe au tick suivant
+ * Un consommateur mémorise la valeur renvoyée puis, à son passage suivant,
+ * la donne comme since_tick à entity_find_changed : il voit alors tout ce qui
+ * a été ajouté ou modifié entre-temps.
+ * @param manager Gestionnaire d'entités
+ * @return Nouveau tick courant
+ */
+uint32_t entity_manager_advance_tick(EntityManager* manager);
+
+/**
+ * Marque le composant d'une entité comme modifié au tick courant
+ * À appeler après avoir écrit dans un composant obtenu par entity_get_component.
+ * @param manager Gestionnaire d'entités
+ * @param entity_id ID de l'entité
+ * @param type Type du composant modifié
+ * @return true si le composant existe, false sinon
+ */
+bool entity_mark_changed(EntityManager* manager, EntityID entity_id, ComponentType type);
+
+/**
+ * Récupère le tick de dernière modification d'un composant
+ * @param manager Gestionnaire d'entités
+ * @param entity_id ID de l'entité
+ * @param type Type du composant
+ * @return Tick de modification ou 0 si le composant n'existe pas
+ */
+uint32_t entity_get_change_tick(EntityManager* manager, EntityID entity_id, ComponentType type);
+
+/**
+ * Trouve les entités dont un composant a été ajouté ou modifié depuis un tick
+ * @param manager Gestionnaire d'entités
+ * @param type Type de composant surveillé
+ * @param since_tick Tick de référence (les composants de tick >= since_tick sont renvoyés)
+ * @param out_entities Tableau pour stocker les IDs d'entités trouvées
+ * @param max_entities Taille maximale du tableau
+ * @return Nombre d'entités trouvées
+ */
+int entity_find_changed(EntityManager* manager, ComponentType type, uint32_t since_tick,
+                        EntityID* out_entities, int max_entities);
+
+/**
+ * Mémorise la position de début de pas des Transform modifiés depuis un tick
+ * À appeler au début de chaque pas de simulation avec le tick du pas précédent :
+ * les Transform non modifiés ont déjà previous_x/previous_y égaux à x/y.
+ * Les positions écrites sans entity_mark_changed ne sont pas vues.
+ * @param manager Gestionnaire d'entités
+ * @param since_tick Tick de début du pas précédent
+ * @return Nombre de Transform mis à jour
+ */
+int entity_manager_store_previous_transforms(EntityManager* manager, uint32_t since_tick);
+
+/**
+ * Prépare le parcours des chunks d'archétypes contenant un ensemble de composants
+ * Les tags ne sont pas stockés dans les archétypes : un masque qui en contient
+ * ne correspond à aucun chunk (les filtrer avec entity_get_mask).
+ * @param manager Gestionnaire d'entités
+ * @param mask Masque de composants requis
+ * @param iterator Itérateur à initialiser
+ */
+void entity_chunk_iter_begin(EntityManager* manager, ComponentMask mask, ArchetypeChunkIterator* iterator);
+
+/**
+ * Passe au chunk suivant
+ * @param manager Gestionnaire d'entités
+ * @param iterator Itérateur initialisé par entity_chunk_iter_begin
+ * @param out_view Vue remplie avec les colonnes du chunk
+ * @return true si un chunk a été trouvé, false à la fin du parcours (toujours false en mode pools)
+ */
+bool entity_chunk_iter_next(EntityManager* manager, ArchetypeChunkIterator* iterator, ArchetypeChunkView* out_view);
+
+/**
+ * Calcule la taille de la capture complète du gestionnaire
+ * @param manager Gestionnaire d'entités
+ * @return Taille en octets (0 en cas d'erreur)
+ */
+size_t entity_manager_snapshot_size(EntityManager* manager);
+
+/**
+ * Écrit l'état complet du gestionnaire (entités, masques, générations, index libres,
+ * composants et ticks) dans un bloc contigu versionné
+ * Les composants sont copiés page par page (pools) ou chunk par chunk (archétypes).
+ * Le tampon peut être réutilisé d'une capture à l'autre (retour arrière).
+ * @param manager Gestionnaire d'entités
+ * @param buffer Tampon de destination
+ * @param capacity Taille du tampon (au moins entity_manager_snapshot_size)
+ * @return Nombre d'octets écrits ou 0 en cas d'erreur
+ */
+size_t entity_manager_snapshot(EntityManager* manager, void* buffer, size_t capacity);
+
+/**
+ * Restaure l'état du gestionnaire depuis une capture
+ * La capture doit provenir du même mode de stockage et des mêmes tailles de
+ * composants. Les vues de requête enregistrées sont reconstruites ; les ID
+ * obtenus après la capture ne doivent plus être utilisés.
+ * En cas d'échec de validation, le gestionnaire n'est pas modifié.
+ * @param manager Gestionnaire d'entités
+ * @param buffer Capture produite par entity_manager_snapshot
+ * @param size Taille de la capture
+ * @return true si la restauration a réussi, false sinon
+ */
+bool entity_manager_restore(EntityManager* manager, const void* buffer, size_t size);
+
 #endif /* ENTITY_MANAGER_H */
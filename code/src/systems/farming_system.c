@@ -55,97 +55,118 @@ void farming_system_shutdown(FarmingSystem* system) {
     log_info("Système de farming libéré");
 }
 
-/**
- * Met à jour le système de farming (croissance des plantes, etc.)
- * @param system Système de farming
- * @param days_elapsed Nombre de jours écoulés
- */
-void farming_system_update(FarmingSystem* system, float days_elapsed) {
-    if (!system || !system->world_system || !system->world_system->current_map) return;
-    
-    // Obtenir la saison actuelle
-    Season current_season = system->world_system->time_system.season;
-    SeasonFlags season_flag = 1 << current_season;
-    
-    // Parcourir toutes les tuiles du monde pour mettre à jour les plantes
-    Map* map = system->world_system->current_map;
-    
-    for (int cy = 0; cy < map->chunks_y; cy++) {
-        for (int cx = 0; cx < map->chunks_x; cx++) {
-            int chunk_index = cy * map->chunks_x + cx;
-            Chunk* chunk = map->chunks[chunk_index];
-            
-            if (!chunk || !chunk->is_loaded) continue;
-            
-            for (int x = 0; x < map->chunk_size; x++) {
-                for (int y = 0; y < map->chunk_size; y++) {
-                    // Vérifier s'il y a une plante sur cette tuile
-                    Tile* tile = &chunk->tiles[x][y][LAYER_ITEMS];
-                    if (tile->type == TILE_NONE) continue;
-                    
-                    // Obtenez l'état de la plante associée à cette tuile
-                    PlantState state;
-                    if (!farming_system_get_plant_state(system, cx * map->chunk_size + x, cy * map->chunk_size + y, &state)) {
-                        continue;
-                    }
-                    
-                    // Ne pas mettre à jour les plantes mortes
-                    if (state.is_dead) continue;
-                    
-                    // Vérifier si la plante est dans une serre
-                    bool is_in_greenhouse = state.is_in_greenhouse;
-                    
-                    // Obtenir les données de la plante
-                    const PlantData* plant_data = farming_system_get_plant_data(system, state.plant_id);
-                    if (!plant_data) continue;
-                    
-                    // Vérifier si la plante peut pousser dans cette saison
-                    bool can_grow = is_in_greenhouse || (plant_data->seasons & season_flag);
-                    
-                    if (!can_grow) {
-                        // La plante ne peut pas pousser dans cette saison, elle meurt
-                        state.is_dead = true;
-                        // Mettre à jour l'état de la plante sur la tuile
-                        // TODO: Implémenter la mise à jour de l'état de la plante
-                        continue;
-                    }
+// Paramètres d'une mise à jour de farming, partagés par les tranches de chunks
+typedef struct {
+    FarmingSystem* system;     // Système de farming
+    Map* map;                  // Carte mise à jour
+    SeasonFlags season_flag;   // Saison actuelle
+    float days_elapsed;        // Nombre de jours écoulés
+} FarmingUpdate;
+
+// Met à jour les plantes d'une tranche de chunks (appelée par parallel_for)
+static void farming_update_chunks(void* context, int start, int end) {
+    FarmingUpdate* update = (FarmingUpdate*)context;
+    Map* map = update->map;
+    
+    for (int chunk_index = start; chunk_index < end; chunk_index++) {
+        int cx = chunk_index % map->chunks_x;
+        int cy = chunk_index / map->chunks_x;
+        Chunk* chunk = map->chunks[chunk_index];
+        
+        if (!chunk || !chunk->is_loaded) continue;
+        
+        for (int x = 0; x < map->chunk_size; x++) {
+            for (int y = 0; y < map->chunk_size; y++) {
+                // Vérifier s'il y a une plante sur cette tuile
+                Tile* tile = &chunk->tiles[x][y][LAYER_ITEMS];
+                if (tile->type == TILE_NONE) continue;
+                
+                // Obtenez l'état de la plante associée à cette tuile
+                PlantState state;
+                if (!farming_system_get_plant_state(update->system, cx * map->chunk_size + x, cy * map->chunk_size + y, &state)) {
+                    continue;
+                }
+                
+                // Ne pas mettre à jour les plantes mortes
+                if (state.is_dead) continue;
+                
+                // Vérifier si la plante est dans une serre
+                bool is_in_greenhouse = state.is_in_greenhouse;
+                
+                // Obtenir les données de la plante
+                const PlantData* plant_data = farming_system_get_plant_data(update->system, state.plant_id);
+                if (!plant_data) continue;
+                
+                // Vérifier si la plante peut pousser dans cette saison
+                bool can_grow = is_in_greenhouse || (plant_data->seasons & update->season_flag);
+                
+                if (!can_grow) {
+                    // La plante ne peut pas pousser dans cette saison, elle meurt
+                    state.is_dead = true;
+                    // Mettre à jour l'état de la plante sur la tuile
+                    // TODO: Implémenter la mise à jour de l'état de la plante
+                    continue;
+                }
+                
+                // Mettre à jour la croissance si la plante a été arrosée
+                if (state.is_watered || is_in_greenhouse) {
+                    // Ajouter le temps écoulé à la croissance
+                    state.days_growing += update->days_elapsed;
                     
-                    // Mettre à jour la croissance si la plante a été arrosée
-                    if (state.is_watered || is_in_greenhouse) {
-                        // Ajouter le temps écoulé à la croissance
-                        state.days_growing += days_elapsed;
+                    // Mettre à jour l'étape de croissance
+                    if (state.is_harvestable) {
+                        // Plante déjà prête à être récoltée, ne rien faire
+                    } else if (state.growth_stage < plant_data->growth_stages - 1) {
+                        // Calculer la nouvelle étape de croissance
+                        float growth_progress = state.days_growing / plant_data->days_to_mature;
+                        int new_stage = (int)(growth_progress * (plant_data->growth_stages - 1));
                         
-                        // Mettre à jour l'étape de croissance
-                        if (state.is_harvestable) {
-                            // Plante déjà prête à être récoltée, ne rien faire
-                        } else if (state.growth_stage < plant_data->growth_stages - 1) {
-                            // Calculer la nouvelle étape de croissance
-                            float growth_progress = state.days_growing / plant_data->days_to_mature;
-                            int new_stage = (int)(growth_progress * (plant_data->growth_stages - 1));
-                            
-                            // Limiter l'étape de croissance au maximum
-                            if (new_stage >= plant_data->growth_stages - 1) {
-                                new_stage = plant_data->growth_stages - 1;
-                                
-                                // Marquer comme prête à être récoltée
-                                state.is_harvestable = true;
-                            }
+                        // Limiter l'étape de croissance au maximum
+                        if (new_stage >= plant_data->growth_stages - 1) {
+                            new_stage = plant_data->growth_stages - 1;
                             
-                            state.growth_stage = new_stage;
+                            // Marquer comme prête à être récoltée
+                            state.is_harvestable = true;
                         }
                         
-                        // Réinitialiser l'état arrosé pour le jour suivant
-                        state.is_watered = false;
+                        state.growth_stage = new_stage;
                     }
                     
-                    // Mettre à jour l'état de la plante sur la tuile
-                    // TODO: Implémenter la mise à jour de l'état de la plante
+                    // Réinitialiser l'état arrosé pour le jour suivant
+                    state.is_watered = false;
                 }
+                
+                // Mettre à jour l'état de la plante sur la tuile
+                // TODO: Implémenter la mise à jour de l'état de la plante
             }
         }
     }
 }
 
+/**
+ * Met à jour le système de farming (croissance des plantes, etc.)
+ * @param system Système de farming
+ * @param days_elapsed Nombre de jours écoulés
+ */
+void farming_system_update(FarmingSystem* system, float days_elapsed) {
+    if (!system || !system->world_system || !system->world_system->current_map) return;
+    
+    // Obtenir la saison actuelle
+    Season current_season = system->world_system->time_system.season;
+    
+    FarmingUpdate update;
+    update.system = system;
+    update.map = system->world_system->current_map;
+    update.season_flag = 1 << current_season;
+    update.days_elapsed = days_elapsed;
+    
+    // Parcourir toutes les tuiles du monde pour mettre à jour les plantes,
+    // les chunks étant répartis entre les threads du système de jobs
+    int chunk_count = update.map->chunks_x * update.map->chunks_y;
+    job_parallel_for(system->job_system, 0, chunk_count, FARMING_CHUNKS_PER_JOB,
+                     farming_update_chunks, &update);
+}
+
 /**
  * Laboure une tuile à la position spécifiée
  * @param system Système de farming
@@ -10,6 +10,10 @@
 #include "../core/entity.h"
 #include "../systems/entity_manager.h"
 #include "../systems/world.h"
+#include "../systems/job_system.h"
+
+// Nombre de chunks traités par job lors de la mise à jour des plantes
+#define FARMING_CHUNKS_PER_JOB 4
 
 // Types de plantes
 typedef enum {
@@ -77,6 +81,8 @@ typedef struct {
     // Tables de conversion entre types de tuiles et états
     TileType tilled_soil_type;      // Type de tuile pour sol labouré
     TileType watered_soil_type;     // Type de tuile pour sol arrosé
+    
+    JobSystem* job_system;          // Répartit les chunks entre threads (NULL : séquentiel)
 } FarmingSystem;
 
 /**
@@ -0,0 +1,461 @@
+/**
+ * job_system.c
+ * Implémentation du système de jobs à vol de tâches
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../systems/job_system.h"
+#include "../utils/error_handler.h"
+
+// Tentatives de vol infructueuses avant qu'un thread inactif ne s'endorme
+#define JOB_IDLE_SPINS 64
+
+// Tranche de parallel_for, copiée dans le payload du job
+typedef struct {
+    JobSystem* system;             // Système qui exécute les tranches
+    ParallelForFunction function;  // Fonction appelée sur chaque tranche
+    void* context;                 // Données passées à la fonction
+    int start;                     // Premier index de la tranche
+    int end;                       // Index de fin (exclu)
+    int grain;                     // Taille maximale d'une tranche
+} ParallelForRange;
+
+// Écart entre deux positions de file (reste correct quand les compteurs débordent)
+static int deque_distance(int from, int to) {
+    return (int)((unsigned int)to - (unsigned int)from);
+}
+
+// Empile un job en bas de la file (propriétaire uniquement)
+static bool deque_push(JobDeque* deque, Job* job) {
+    int bottom = SDL_AtomicGet(&deque->bottom);
+    int top = SDL_AtomicGet(&deque->top);
+    if (deque_distance(top, bottom) >= JOB_DEQUE_CAPACITY) return false;
+
+    SDL_AtomicSetPtr((void**)&deque->slots[(unsigned int)bottom & (JOB_DEQUE_CAPACITY - 1)], job);
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&deque->bottom, bottom + 1);
+    return true;
+}
+
+// Dépile le dernier job empilé (propriétaire uniquement)
+static Job* deque_pop(JobDeque* deque) {
+    // L'addition atomique sert aussi de barrière complète avant la lecture de top
+    int bottom = SDL_AtomicAdd(&deque->bottom, -1) - 1;
+    int top = SDL_AtomicGet(&deque->top);
+
+    if (deque_distance(top, bottom) < 0) {
+        // File vide : rétablir bottom
+        SDL_AtomicSet(&deque->bottom, top);
+        return NULL;
+    }
+
+    Job* job = (Job*)SDL_AtomicGetPtr((void**)&deque->slots[(unsigned int)bottom & (JOB_DEQUE_CAPACITY - 1)]);
+    if (top != bottom) return job;
+
+    // Dernier job : la course se règle avec les voleurs sur top
+    if (!SDL_AtomicCAS(&deque->top, top, top + 1)) {
+        job = NULL;
+    }
+    SDL_AtomicSet(&deque->bottom, top + 1);
+    return job;
+}
+
+// Vole le plus ancien job d'une file (n'importe quel thread)
+static Job* deque_steal(JobDeque* deque) {
+    int top = SDL_AtomicGet(&deque->top);
+    SDL_MemoryBarrierAcquire();
+    int bottom = SDL_AtomicGet(&deque->bottom);
+
+    if (deque_distance(top, bottom) <= 0) return NULL;
+
+    Job* job = (Job*)SDL_AtomicGetPtr((void**)&deque->slots[(unsigned int)top & (JOB_DEQUE_CAPACITY - 1)]);
+    if (!SDL_AtomicCAS(&deque->top, top, top + 1)) {
+        // Un autre thread a pris ce job
+        return NULL;
+    }
+    return job;
+}
+
+// Renvoie le JobWorker du thread appelant (NULL hors des threads du système)
+static JobWorker* current_worker(JobSystem* system) {
+    return (JobWorker*)SDL_TLSGet(system->worker_key);
+}
+
+// Générateur xorshift propre à chaque thread
+static unsigned int next_random(JobWorker* worker) {
+    unsigned int x = worker->random_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    worker->random_state = x;
+    return x;
+}
+
+// Cherche un job : d'abord dans sa propre file, puis chez les autres threads
+static Job* find_job(JobSystem* system, JobWorker* worker) {
+    if (worker) {
+        Job* job = deque_pop(&worker->deque);
+        if (job) return job;
+    }
+
+    // Commencer par une victime au hasard pour répartir les vols
+    int count = system->worker_count;
+    int first = worker ? (int)(next_random(worker) % (unsigned int)count) : 0;
+    for (int i = 0; i < count; i++) {
+        JobWorker* victim = &system->workers[(first + i) % count];
+        if (victim == worker) continue;
+
+        Job* job = deque_steal(&victim->deque);
+        if (job) return job;
+    }
+
+    return NULL;
+}
+
+static void execute_job(JobSystem* system, Job* job);
+static void parallel_for_job(Job* job, void* data);
+
+// Place un job prêt dans la file du thread appelant
+static void push_job(JobSystem* system, Job* job) {
+    JobWorker* worker = current_worker(system);
+
+    // Hors des threads du système ou file pleine : exécuter tout de suite
+    if (!worker || !deque_push(&worker->deque, job)) {
+        execute_job(system, job);
+        return;
+    }
+
+    if (SDL_AtomicGet(&system->sleeping) > 0) {
+        SDL_SemPost(system->wake_semaphore);
+    }
+}
+
+// Retire une condition de démarrage ; le job est placé en file quand il n'en reste plus
+static void release_job(JobSystem* system, Job* job) {
+    if (SDL_AtomicDecRef(&job->dependencies)) {
+        push_job(system, job);
+    }
+}
+
+// Marque un job terminé, puis son parent si c'était son dernier enfant
+static void finish_job(JobSystem* system, Job* job) {
+    while (job) {
+        // Lire le job avant la décrémentation : il peut être réutilisé juste après
+        Job* parent = job->parent;
+        int continuation_count = job->continuation_count;
+        Job* continuations[JOB_MAX_CONTINUATIONS];
+        memcpy(continuations, job->continuations, continuation_count * sizeof(Job*));
+
+        if (!SDL_AtomicDecRef(&job->unfinished)) return;
+
+        // Réveiller les threads bloqués dans job_wait : l'un d'eux attend peut-être ce job
+        // (chacun attend un job différent, d'où un réveil de tous)
+        if (SDL_AtomicGet(&system->waiting) > 0) {
+            SDL_LockMutex(system->wait_mutex);
+            SDL_CondBroadcast(system->wait_condition);
+            SDL_UnlockMutex(system->wait_mutex);
+        }
+
+        for (int i = 0; i < continuation_count; i++) {
+            release_job(system, continuations[i]);
+        }
+        job = parent;
+    }
+}
+
+// Exécute un job puis le marque terminé
+static void execute_job(JobSystem* system, Job* job) {
+    if (job->function) {
+        job->function(job, job->data);
+    }
+    finish_job(system, job);
+}
+
+// Boucle d'un thread de travail
+static int job_worker_main(void* data) {
+    JobWorker* worker = (JobWorker*)data;
+    JobSystem* system = worker->system;
+    int idle_spins = 0;
+
+    SDL_TLSSet(system->worker_key, worker, NULL);
+
+    while (!SDL_AtomicGet(&system->quit)) {
+        Job* job = find_job(system, worker);
+        if (job) {
+            execute_job(system, job);
+            idle_spins = 0;
+            continue;
+        }
+
+        // Rien à voler depuis un moment : dormir jusqu'au prochain job
+        if (++idle_spins >= JOB_IDLE_SPINS) {
+            SDL_AtomicIncRef(&system->sleeping);
+
+            // Regarder une dernière fois après s'être déclaré endormi : un job placé
+            // juste avant a été vu ici, un job placé juste après poste le sémaphore
+            job = find_job(system, worker);
+            if (!job && !SDL_AtomicGet(&system->quit)) {
+                SDL_SemWait(system->wake_semaphore);
+            }
+            SDL_AtomicAdd(&system->sleeping, -1);
+            idle_spins = 0;
+
+            if (job) execute_job(system, job);
+        }
+    }
+
+    return 0;
+}
+
+// Crée un job de parallel_for portant une copie de la plage
+static Job* create_range_job(JobSystem* system, Job* parent, const ParallelForRange* range) {
+    Job* job = parent ? job_create_child(system, parent, parallel_for_job, NULL)
+                      : job_create(system, parallel_for_job, NULL);
+    if (!job) return NULL;
+
+    memcpy(job->payload, range, sizeof(ParallelForRange));
+    job->data = job->payload;
+    return job;
+}
+
+// Job de parallel_for : détache la moitié haute de la plage tant qu'elle dépasse le grain
+static void parallel_for_job(Job* job, void* data) {
+    ParallelForRange range = *(ParallelForRange*)data;
+
+    // Chaque moitié détachée devient un enfant que les autres threads peuvent voler
+    while (range.end - range.start > range.grain) {
+        int middle = range.start + (range.end - range.start) / 2;
+        ParallelForRange upper = range;
+        upper.start = middle;
+
+        Job* child = create_range_job(range.system, job, &upper);
+        if (!child) break;
+
+        job_run(range.system, child);
+        range.end = middle;
+    }
+
+    range.function(range.context, range.start, range.end);
+}
+
+// Initialise le système de jobs
+JobSystem* job_system_init(int worker_count) {
+    JobSystem* system = (JobSystem*)calloc(1, sizeof(JobSystem));
+    if (!check_ptr(system, LOG_LEVEL_ERROR, "Échec d'allocation du système de jobs")) {
+        return NULL;
+    }
+
+    // Par défaut, un thread par cœur en plus du thread principal
+    if (worker_count < 0) {
+        worker_count = SDL_GetCPUCount() - 1;
+    }
+    if (worker_count < 0) worker_count = 0;
+    if (worker_count > MAX_JOB_WORKERS) worker_count = MAX_JOB_WORKERS;
+
+    system->worker_count = worker_count + 1;
+    system->workers = (JobWorker*)calloc(system->worker_count, sizeof(JobWorker));
+    system->worker_key = SDL_TLSCreate();
+    system->wake_semaphore = SDL_CreateSemaphore(0);
+    system->wait_mutex = SDL_CreateMutex();
+    system->wait_condition = SDL_CreateCond();
+    if (!system->workers || !system->worker_key || !system->wake_semaphore ||
+        !system->wait_mutex || !system->wait_condition) {
+        log_error("Échec d'initialisation du système de jobs : %s", SDL_GetError());
+        job_system_shutdown(system);
+        return NULL;
+    }
+
+    for (int i = 0; i < system->worker_count; i++) {
+        JobWorker* worker = &system->workers[i];
+        worker->job_pool = (Job*)calloc(JOB_POOL_CAPACITY, sizeof(Job));
+        if (!check_ptr(worker->job_pool, LOG_LEVEL_ERROR, "Échec d'allocation des jobs d'un thread")) {
+            job_system_shutdown(system);
+            return NULL;
+        }
+        worker->system = system;
+        worker->index = i;
+        worker->random_state = 2654435761u * (unsigned int)(i + 1);
+    }
+
+    // Le thread appelant est le thread principal (index 0)
+    SDL_TLSSet(system->worker_key, &system->workers[0], NULL);
+
+    int started = 0;
+    for (int i = 1; i < system->worker_count; i++) {
+        JobWorker* worker = &system->workers[i];
+        worker->thread = SDL_CreateThread(job_worker_main, "JobWorker", worker);
+        if (!worker->thread) {
+            // La file de ce thread reste vide : les autres fonctionnent sans lui
+            log_warning("Échec de création d'un thread de travail : %s", SDL_GetError());
+            continue;
+        }
+        started++;
+    }
+
+    log_info("Système de jobs initialisé avec %d threads de travail", started);
+    return system;
+}
+
+// Arrête les threads et libère le système de jobs
+void job_system_shutdown(JobSystem* system) {
+    if (!system) return;
+
+    SDL_AtomicSet(&system->quit, 1);
+
+    if (system->workers) {
+        for (int i = 1; i < system->worker_count; i++) {
+            if (system->workers[i].thread) SDL_SemPost(system->wake_semaphore);
+        }
+        for (int i = 0; i < system->worker_count; i++) {
+            if (system->workers[i].thread) SDL_WaitThread(system->workers[i].thread, NULL);
+            free(system->workers[i].job_pool);
+        }
+        free(system->workers);
+    }
+
+    if (system->worker_key) SDL_TLSSet(system->worker_key, NULL, NULL);
+    if (system->wake_semaphore) SDL_DestroySemaphore(system->wake_semaphore);
+    if (system->wait_condition) SDL_DestroyCond(system->wait_condition);
+    if (system->wait_mutex) SDL_DestroyMutex(system->wait_mutex);
+    free(system);
+
+    log_info("Système de jobs libéré");
+}
+
+// Crée un job (non lancé)
+Job* job_create(JobSystem* system, JobFunction function, void* data) {
+    if (!system) return NULL;
+
+    JobWorker* worker = current_worker(system);
+    if (!worker) {
+        log_error("Création d'un job hors des threads du système de jobs");
+        return NULL;
+    }
+
+    // Tampon circulaire rempli de jobs en cours (ex: parallel_for imbriqués pendant un
+    // job_wait) : refuser plutôt que d'écraser un job vivant, l'appelant exécute sur place
+    Job* job = &worker->job_pool[worker->job_next & (JOB_POOL_CAPACITY - 1)];
+    if (SDL_AtomicGet(&job->unfinished) > 0) {
+        log_debug("Plus de job libre sur ce thread, exécution sur place");
+        return NULL;
+    }
+    worker->job_next++;
+
+    job->function = function;
+    job->data = data;
+    job->parent = NULL;
+    job->continuation_count = 0;
+    SDL_AtomicSet(&job->unfinished, 1);
+    // La condition restante est le lancement par job_run
+    SDL_AtomicSet(&job->dependencies, 1);
+    return job;
+}
+
+// Crée un job enfant
+Job* job_create_child(JobSystem* system, Job* parent, JobFunction function, void* data) {
+    if (!parent) return NULL;
+
+    Job* job = job_create(system, function, data);
+    if (!job) return NULL;
+
+    SDL_AtomicIncRef(&parent->unfinished);
+    job->parent = parent;
+    return job;
+}
+
+// Déclare qu'un job ne peut démarrer qu'après la fin d'un autre
+bool job_add_dependency(Job* job, Job* prerequisite) {
+    if (!job || !prerequisite) return false;
+
+    if (prerequisite->continuation_count >= JOB_MAX_CONTINUATIONS) {
+        log_error("Trop de jobs dépendent du même job (maximum %d)", JOB_MAX_CONTINUATIONS);
+        return false;
+    }
+
+    prerequisite->continuations[prerequisite->continuation_count++] = job;
+    SDL_AtomicIncRef(&job->dependencies);
+    return true;
+}
+
+// Lance un job
+void job_run(JobSystem* system, Job* job) {
+    if (!system || !job) return;
+
+    release_job(system, job);
+}
+
+// Attend la fin d'un job en exécutant d'autres jobs en attendant
+void job_wait(JobSystem* system, Job* job) {
+    if (!system || !job) return;
+
+    JobWorker* worker = current_worker(system);
+    int idle_spins = 0;
+    while (!job_is_finished(job)) {
+        Job* next = find_job(system, worker);
+        if (next) {
+            execute_job(system, next);
+            idle_spins = 0;
+            continue;
+        }
+
+        // Plus rien à voler : dormir jusqu'à la fin d'un job plutôt que de tourner à vide
+        if (++idle_spins >= JOB_IDLE_SPINS) {
+            SDL_LockMutex(system->wait_mutex);
+            SDL_AtomicIncRef(&system->waiting);
+            if (!job_is_finished(job)) {
+                SDL_CondWait(system->wait_condition, system->wait_mutex);
+            }
+            SDL_AtomicAdd(&system->waiting, -1);
+            SDL_UnlockMutex(system->wait_mutex);
+            idle_spins = 0;
+        }
+    }
+}
+
+// Indique si un job et tous ses enfants sont terminés
+bool job_is_finished(Job* job) {
+    return !job || SDL_AtomicGet(&job->unfinished) == 0;
+}
+
+// Crée un job qui découpe [start, end[ en tranches
+Job* job_create_parallel_for(JobSystem* system, int start, int end, int grain,
+                             ParallelForFunction function, void* context) {
+    if (!system || !function) return NULL;
+
+    ParallelForRange range;
+    range.system = system;
+    range.function = function;
+    range.context = context;
+    range.start = start;
+    range.end = end > start ? end : start;
+    range.grain = grain > 0 ? grain : 1;
+
+    // Limiter le nombre de tranches pour ne pas réutiliser des jobs encore en cours
+    // (une tranche peut descendre à grain / 2 : au plus JOB_POOL_CAPACITY / 2 tranches)
+    int max_slices = JOB_POOL_CAPACITY / 4;
+    int min_grain = (range.end - range.start + max_slices - 1) / max_slices;
+    if (range.grain < min_grain) range.grain = min_grain;
+    return create_range_job(system, NULL, &range);
+}
+
+// Exécute function sur [start, end[ en parallèle et attend la fin
+void job_parallel_for(JobSystem* system, int start, int end, int grain,
+                      ParallelForFunction function, void* context) {
+    if (!function || end <= start) return;
+
+    // Plage trop petite ou pas de thread disponible : pas de découpage
+    if (!system || end - start <= grain || !current_worker(system)) {
+        function(context, start, end);
+        return;
+    }
+
+    Job* job = job_create_parallel_for(system, start, end, grain, function, context);
+    if (!job) {
+        function(context, start, end);
+        return;
+    }
+
+    job_run(system, job);
+    job_wait(system, job);
+}
@@ -0,0 +1,176 @@
+/**
+ * job_system.h
+ * Système de jobs à vol de tâches : files par thread, dépendances et parallel_for
+ */
+
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <stdbool.h>
+#include <SDL2/SDL.h>
+
+// Nombre maximum de threads de travail (en plus du thread principal)
+#define MAX_JOB_WORKERS 15
+
+// Nombre de jobs alloués par thread avant réutilisation (puissance de 2)
+#define JOB_POOL_CAPACITY 4096
+
+// Capacité de la file de chaque thread (puissance de 2)
+#define JOB_DEQUE_CAPACITY 4096
+
+// Nombre maximum de jobs pouvant attendre la fin d'un même job
+#define JOB_MAX_CONTINUATIONS 4
+
+// Taille des données pouvant être copiées dans le job lui-même
+#define JOB_PAYLOAD_SIZE 48
+
+typedef struct Job Job;
+
+// Fonction exécutée par un job
+typedef void (*JobFunction)(Job* job, void* data);
+
+// Fonction exécutée par parallel_for sur une tranche [start, end[
+typedef void (*ParallelForFunction)(void* context, int start, int end);
+
+// Job : unité de travail exécutée par n'importe quel thread
+struct Job {
+    JobFunction function;                        // Fonction à exécuter
+    void* data;                                  // Données passées à la fonction
+    Job* parent;                                 // Job parent (terminé après ses enfants)
+    SDL_atomic_t unfinished;                     // Le job lui-même + ses enfants non terminés
+    SDL_atomic_t dependencies;                   // Prérequis non terminés + lancement en attente
+    Job* continuations[JOB_MAX_CONTINUATIONS];   // Jobs qui dépendent de celui-ci
+    int continuation_count;                      // Nombre de jobs dépendants
+    void* payload[JOB_PAYLOAD_SIZE / sizeof(void*)];  // Données internes (parallel_for)
+};
+
+// File d'un thread : le propriétaire empile et dépile en bas, les autres volent en haut
+typedef struct {
+    SDL_atomic_t top;                    // Prochain job à voler
+    char padding[60];                    // Sépare top et bottom sur deux lignes de cache
+    SDL_atomic_t bottom;                 // Prochaine place libre
+    Job* slots[JOB_DEQUE_CAPACITY];      // Jobs en attente
+} JobDeque;
+
+// Données propres à un thread du système
+typedef struct {
+    JobDeque deque;                      // File de jobs du thread
+    Job* job_pool;                       // Jobs alloués par ce thread (tampon circulaire)
+    unsigned int job_next;               // Prochain job à allouer dans job_pool
+    unsigned int random_state;           // Générateur pour choisir la victime d'un vol
+    SDL_Thread* thread;                  // Thread (NULL pour le thread principal)
+    struct JobSystem* system;            // Système propriétaire
+    int index;                           // Index du thread dans le système
+} JobWorker;
+
+// Système de jobs
+typedef struct JobSystem {
+    JobWorker* workers;                  // Thread principal (index 0) puis threads de travail
+    int worker_count;                    // Nombre total de threads, thread principal compris
+    SDL_TLSID worker_key;                // Associe chaque thread à son JobWorker
+    SDL_sem* wake_semaphore;             // Réveille les threads inactifs
+    SDL_atomic_t sleeping;               // Nombre de threads endormis
+    SDL_mutex* wait_mutex;               // Protège l'attente des threads bloqués dans job_wait
+    SDL_cond* wait_condition;            // Signalée à chaque fin de job si un thread attend
+    SDL_atomic_t waiting;                // Nombre de threads bloqués dans job_wait
+    SDL_atomic_t quit;                   // Demande d'arrêt des threads
+} JobSystem;
+
+/**
+ * Initialise le système de jobs
+ * Le thread appelant devient le thread principal du système.
+ * @param worker_count Nombre de threads de travail (-1 : un par cœur moins le thread principal)
+ * @return Pointeur vers le système ou NULL en cas d'erreur
+ */
+JobSystem* job_system_init(int worker_count);
+
+/**
+ * Arrête les threads et libère le système de jobs
+ * Tous les jobs lancés doivent être terminés.
+ * @param system Système à libérer
+ */
+void job_system_shutdown(JobSystem* system);
+
+/**
+ * Crée un job (non lancé)
+ * Les jobs sont pris dans un tampon circulaire propre au thread appelant. Si le job
+ * suivant du tampon n'est pas encore terminé, la création échoue au lieu de l'écraser.
+ * Les fonctions de création et de lancement ne doivent être appelées que depuis
+ * le thread principal ou depuis un job.
+ * @param system Système de jobs
+ * @param function Fonction à exécuter
+ * @param data Données passées à la fonction
+ * @return Pointeur vers le job ou NULL en cas d'erreur
+ */
+Job* job_create(JobSystem* system, JobFunction function, void* data);
+
+/**
+ * Crée un job enfant : le parent n'est terminé qu'une fois tous ses enfants terminés
+ * @param system Système de jobs
+ * @param parent Job parent (pas encore terminé)
+ * @param function Fonction à exécuter
+ * @param data Données passées à la fonction
+ * @return Pointeur vers le job ou NULL en cas d'erreur
+ */
+Job* job_create_child(JobSystem* system, Job* parent, JobFunction function, void* data);
+
+/**
+ * Déclare qu'un job ne peut démarrer qu'après la fin d'un autre
+ * À appeler avant de lancer l'un ou l'autre des deux jobs.
+ * @param job Job dépendant
+ * @param prerequisite Job à terminer d'abord
+ * @return true si la dépendance a été ajoutée, false sinon
+ */
+bool job_add_dependency(Job* job, Job* prerequisite);
+
+/**
+ * Lance un job : il s'exécute dès que ses prérequis sont terminés
+ * @param system Système de jobs
+ * @param job Job à lancer
+ */
+void job_run(JobSystem* system, Job* job);
+
+/**
+ * Attend la fin d'un job en exécutant d'autres jobs en attendant
+ * @param system Système de jobs
+ * @param job Job à attendre
+ */
+void job_wait(JobSystem* system, Job* job);
+
+/**
+ * Indique si un job et tous ses enfants sont terminés
+ * @param job Job à tester
+ * @return true si le job est terminé, false sinon
+ */
+bool job_is_finished(Job* job);
+
+/**
+ * Crée un job qui découpe [start, end[ en tranches d'au plus grain éléments
+ * réparties entre les threads (non lancé : peut recevoir des dépendances)
+ * Le grain est augmenté si nécessaire pour ne pas dépasser JOB_POOL_CAPACITY / 2 tranches.
+ * @param system Système de jobs
+ * @param start Premier index
+ * @param end Index de fin (exclu)
+ * @param grain Taille maximale d'une tranche
+ * @param function Fonction appelée sur chaque tranche
+ * @param context Données passées à la fonction
+ * @return Pointeur vers le job ou NULL en cas d'erreur
+ */
+Job* job_create_parallel_for(JobSystem* system, int start, int end, int grain,
+                             ParallelForFunction function, void* context);
+
+/**
+ * Exécute function sur [start, end[ découpé en tranches d'au plus grain éléments
+ * et attend la fin de toutes les tranches
+ * Sans système de jobs, la plage entière est traitée sur le thread appelant.
+ * @param system Système de jobs (peut être NULL)
+ * @param start Premier index
+ * @param end Index de fin (exclu)
+ * @param grain Taille maximale d'une tranche
+ * @param function Fonction appelée sur chaque tranche
+ * @param context Données passées à la fonction
+ */
+void job_parallel_for(JobSystem* system, int start, int end, int grain,
+                      ParallelForFunction function, void* context);
+
+#endif /* JOB_SYSTEM_H */
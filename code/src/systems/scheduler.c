@@ -0,0 +1,123 @@
+/**
+ * scheduler.c
+ * Implémentation de l'ordonnanceur de systèmes
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../systems/scheduler.h"
+#include "../utils/error_handler.h"
+
+// Indique si deux systèmes ne peuvent pas s'exécuter en même temps
+static bool systems_conflict(const ScheduledSystem* a, const ScheduledSystem* b) {
+    if (a->exclusive || b->exclusive) return true;
+
+    return (a->writes & (b->reads | b->writes)) != 0 ||
+           (b->writes & a->reads) != 0;
+}
+
+// Regroupe les systèmes en étapes en respectant l'ordre des systèmes en conflit
+static void build_stages(SystemScheduler* scheduler) {
+    int stage_of[MAX_SCHEDULED_SYSTEMS];
+    int stage_count = 0;
+
+    // Chaque système va dans l'étape qui suit le dernier système antérieur en conflit
+    for (int i = 0; i < scheduler->system_count; i++) {
+        int stage = 0;
+        for (int j = 0; j < i; j++) {
+            if (stage_of[j] >= stage && systems_conflict(&scheduler->systems[i], &scheduler->systems[j])) {
+                stage = stage_of[j] + 1;
+            }
+        }
+        stage_of[i] = stage;
+        if (stage + 1 > stage_count) stage_count = stage + 1;
+    }
+
+    // Trier les systèmes par étape (ordre d'enregistrement conservé dans une étape)
+    int position = 0;
+    for (int stage = 0; stage < stage_count; stage++) {
+        scheduler->stage_start[stage] = position;
+        for (int i = 0; i < scheduler->system_count; i++) {
+            if (stage_of[i] == stage) {
+                scheduler->stage_order[position++] = i;
+            }
+        }
+    }
+    scheduler->stage_start[stage_count] = position;
+    scheduler->stage_count = stage_count;
+    scheduler->stages_dirty = false;
+
+    log_debug("Ordonnanceur : %d systèmes répartis en %d étapes", scheduler->system_count, stage_count);
+}
+
+// Exécute une tranche de l'étape en cours (appelée par parallel_for)
+static void run_stage_range(void* context, int start, int end) {
+    SystemScheduler* scheduler = (SystemScheduler*)context;
+
+    for (int i = start; i < end; i++) {
+        ScheduledSystem* system = &scheduler->systems[scheduler->stage_order[i]];
+        system->update(system->context, scheduler->delta_time);
+    }
+}
+
+// Initialise l'ordonnanceur
+SystemScheduler* scheduler_init(JobSystem* job_system) {
+    SystemScheduler* scheduler = (SystemScheduler*)calloc(1, sizeof(SystemScheduler));
+    if (!check_ptr(scheduler, LOG_LEVEL_ERROR, "Échec d'allocation de l'ordonnanceur")) {
+        return NULL;
+    }
+
+    scheduler->job_system = job_system;
+
+    log_info("Ordonnanceur initialisé (%s)", job_system ? "parallèle" : "séquentiel");
+    return scheduler;
+}
+
+// Libère l'ordonnanceur
+void scheduler_shutdown(SystemScheduler* scheduler) {
+    if (!scheduler) return;
+
+    free(scheduler);
+
+    log_info("Ordonnanceur libéré");
+}
+
+// Enregistre un système
+int scheduler_add_system(SystemScheduler* scheduler, const char* name, SystemUpdateFunction update,
+                         void* context, ComponentMask reads, ComponentMask writes, bool exclusive) {
+    if (!scheduler || !update) return -1;
+
+    if (scheduler->system_count >= MAX_SCHEDULED_SYSTEMS) {
+        log_error("Impossible d'enregistrer le système %s : limite de %d systèmes atteinte",
+                  name ? name : "?", MAX_SCHEDULED_SYSTEMS);
+        return -1;
+    }
+
+    ScheduledSystem* system = &scheduler->systems[scheduler->system_count];
+    system->name = name;
+    system->update = update;
+    system->context = context;
+    system->reads = reads;
+    system->writes = writes;
+    system->exclusive = exclusive;
+
+    scheduler->stages_dirty = true;
+    return scheduler->system_count++;
+}
+
+// Exécute tous les systèmes, étape par étape
+void scheduler_run(SystemScheduler* scheduler, float delta_time) {
+    if (!scheduler || scheduler->system_count == 0) return;
+
+    if (scheduler->stages_dirty) {
+        build_stages(scheduler);
+    }
+
+    scheduler->delta_time = delta_time;
+
+    // Une tranche par système : chaque système de l'étape peut aller sur un thread différent
+    for (int stage = 0; stage < scheduler->stage_count; stage++) {
+        job_parallel_for(scheduler->job_system, scheduler->stage_start[stage],
+                         scheduler->stage_start[stage + 1], 1, run_stage_range, scheduler);
+    }
+}
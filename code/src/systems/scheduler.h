@@ -0,0 +1,81 @@
+/**
+ * scheduler.h
+ * Ordonnanceur de systèmes : exécution parallèle des systèmes sans conflit d'accès
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdbool.h>
+#include "../core/entity.h"
+#include "../systems/job_system.h"
+
+// Nombre maximum de systèmes enregistrés
+#define MAX_SCHEDULED_SYSTEMS 32
+
+// Fonction de mise à jour d'un système
+typedef void (*SystemUpdateFunction)(void* context, float delta_time);
+
+// Système enregistré avec ses accès déclarés aux composants
+typedef struct {
+    const char* name;              // Nom (journalisation)
+    SystemUpdateFunction update;   // Fonction de mise à jour
+    void* context;                 // Données passées à la fonction
+    ComponentMask reads;           // Types de composants lus
+    ComponentMask writes;          // Types de composants modifiés
+    bool exclusive;                // Accède à un état non déclaré : s'exécute seul, sur le thread appelant
+} ScheduledSystem;
+
+// Ordonnanceur : systèmes regroupés en étapes dont les membres peuvent s'exécuter en parallèle
+typedef struct {
+    ScheduledSystem systems[MAX_SCHEDULED_SYSTEMS];  // Systèmes dans l'ordre d'enregistrement
+    int system_count;                                // Nombre de systèmes
+
+    int stage_order[MAX_SCHEDULED_SYSTEMS];          // Systèmes triés par étape
+    int stage_start[MAX_SCHEDULED_SYSTEMS + 1];      // Début de chaque étape dans stage_order
+    int stage_count;                                 // Nombre d'étapes
+    bool stages_dirty;                               // Étapes à recalculer
+
+    JobSystem* job_system;                           // Système de jobs (NULL : exécution séquentielle)
+    float delta_time;                                // Delta time de la mise à jour en cours
+} SystemScheduler;
+
+/**
+ * Initialise l'ordonnanceur
+ * @param job_system Système de jobs qui exécute les étapes (NULL : exécution séquentielle)
+ * @return Pointeur vers l'ordonnanceur ou NULL en cas d'erreur
+ */
+SystemScheduler* scheduler_init(JobSystem* job_system);
+
+/**
+ * Libère l'ordonnanceur
+ * @param scheduler Ordonnanceur à libérer
+ */
+void scheduler_shutdown(SystemScheduler* scheduler);
+
+/**
+ * Enregistre un système
+ * Deux systèmes sont en conflit si l'un écrit un type que l'autre lit ou écrit ;
+ * les systèmes en conflit s'exécutent dans leur ordre d'enregistrement.
+ * @param scheduler Ordonnanceur
+ * @param name Nom du système
+ * @param update Fonction de mise à jour
+ * @param context Données passées à la fonction
+ * @param reads Types de composants lus
+ * @param writes Types de composants modifiés
+ * @param exclusive true si le système touche un état partagé non déclaré
+ * @return Index du système ou -1 en cas d'erreur
+ */
+int scheduler_add_system(SystemScheduler* scheduler, const char* name, SystemUpdateFunction update,
+                         void* context, ComponentMask reads, ComponentMask writes, bool exclusive);
+
+/**
+ * Exécute tous les systèmes, étape par étape
+ * À appeler depuis le thread principal du système de jobs ; retourne quand tous
+ * les systèmes ont terminé.
+ * @param scheduler Ordonnanceur
+ * @param delta_time Temps écoulé depuis la dernière mise à jour en secondes
+ */
+void scheduler_run(SystemScheduler* scheduler, float delta_time);
+
+#endif /* SCHEDULER_H */
@@ -0,0 +1,341 @@
+/**
+ * spatial_hash.c
+ * Implémentation de la grille uniforme hachée
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../systems/spatial_hash.h"
+#include "../utils/error_handler.h"
+
+// Capacité initiale du tableau sparse
+#define INITIAL_SPARSE_CAPACITY 1024
+
+// Capacité initiale des tableaux de boîtes et de nœuds
+#define INITIAL_ENTRY_CAPACITY 256
+
+// Seau d'une cellule
+static inline int cell_bucket(const SpatialHash* hash, int cell_x, int cell_y) {
+    uint32_t h = (uint32_t)cell_x * 73856093u ^ (uint32_t)cell_y * 19349663u;
+    return (int)(h & (uint32_t)hash->bucket_mask);
+}
+
+// Cellule contenant une coordonnée
+static inline int cell_coord(const SpatialHash* hash, float value) {
+    return (int)floorf(value * hash->inverse_cell_size);
+}
+
+// Garantit que l'index sparse couvre un index d'entité
+static bool ensure_sparse(SpatialHash* hash, uint32_t index) {
+    if (index < hash->sparse_capacity) return true;
+
+    uint32_t new_capacity = hash->sparse_capacity ? hash->sparse_capacity : INITIAL_SPARSE_CAPACITY;
+    while (new_capacity <= index) {
+        new_capacity *= 2;
+    }
+
+    int* new_sparse = (int*)realloc(hash->sparse, new_capacity * sizeof(int));
+    if (!check_ptr(new_sparse, LOG_LEVEL_ERROR, "Échec d'agrandissement de l'index de la grille")) {
+        return false;
+    }
+
+    for (uint32_t i = hash->sparse_capacity; i < new_capacity; i++) {
+        new_sparse[i] = -1;
+    }
+    hash->sparse = new_sparse;
+    hash->sparse_capacity = new_capacity;
+    return true;
+}
+
+// Trouve la position de la boîte d'une entité
+static int find_entry(const SpatialHash* hash, EntityID entity_id) {
+    if (!hash || entity_id == INVALID_ENTITY_ID) return -1;
+
+    uint32_t index = ENTITY_INDEX(entity_id);
+    if (index >= hash->sparse_capacity) return -1;
+
+    int slot = hash->sparse[index];
+    if (slot < 0 || hash->entries[slot].entity != entity_id) return -1;
+    return slot;
+}
+
+// Prend un nœud dans la liste libre ou en fin de tableau
+static int allocate_node(SpatialHash* hash) {
+    if (hash->free_node >= 0) {
+        int node = hash->free_node;
+        hash->free_node = hash->nodes[node].next;
+        return node;
+    }
+
+    if (hash->node_count >= hash->node_capacity) {
+        int new_capacity = hash->node_capacity ? hash->node_capacity * 2 : INITIAL_ENTRY_CAPACITY;
+        SpatialHashNode* new_nodes = (SpatialHashNode*)realloc(hash->nodes, new_capacity * sizeof(SpatialHashNode));
+        if (!check_ptr(new_nodes, LOG_LEVEL_ERROR, "Échec d'agrandissement des nœuds de la grille")) {
+            return -1;
+        }
+        hash->nodes = new_nodes;
+        hash->node_capacity = new_capacity;
+    }
+
+    return hash->node_count++;
+}
+
+// Retire une boîte des seaux de toutes ses cellules
+static void unlink_cells(SpatialHash* hash, int slot) {
+    const SpatialHashEntry* entry = &hash->entries[slot];
+
+    for (int cy = entry->cell_min_y; cy <= entry->cell_max_y; cy++) {
+        for (int cx = entry->cell_min_x; cx <= entry->cell_max_x; cx++) {
+            int* link = &hash->buckets[cell_bucket(hash, cx, cy)];
+            while (*link >= 0) {
+                SpatialHashNode* node = &hash->nodes[*link];
+                if (node->entry == slot && node->cell_x == cx && node->cell_y == cy) {
+                    int freed = *link;
+                    *link = node->next;
+                    node->next = hash->free_node;
+                    hash->free_node = freed;
+                    break;
+                }
+                link = &node->next;
+            }
+        }
+    }
+}
+
+// Ajoute une boîte aux seaux de toutes ses cellules
+static bool link_cells(SpatialHash* hash, int slot) {
+    int cell_min_x = hash->entries[slot].cell_min_x;
+    int cell_min_y = hash->entries[slot].cell_min_y;
+    int cell_max_x = hash->entries[slot].cell_max_x;
+    int cell_max_y = hash->entries[slot].cell_max_y;
+
+    for (int cy = cell_min_y; cy <= cell_max_y; cy++) {
+        for (int cx = cell_min_x; cx <= cell_max_x; cx++) {
+            int node = allocate_node(hash);
+            if (node < 0) return false;
+
+            int bucket = cell_bucket(hash, cx, cy);
+            hash->nodes[node].cell_x = cx;
+            hash->nodes[node].cell_y = cy;
+            hash->nodes[node].entry = slot;
+            hash->nodes[node].next = hash->buckets[bucket];
+            hash->buckets[bucket] = node;
+        }
+    }
+    return true;
+}
+
+// Remplace l'indice d'une boîte dans les nœuds de ses cellules
+static void relink_entry(SpatialHash* hash, int old_slot, int new_slot) {
+    const SpatialHashEntry* entry = &hash->entries[new_slot];
+
+    for (int cy = entry->cell_min_y; cy <= entry->cell_max_y; cy++) {
+        for (int cx = entry->cell_min_x; cx <= entry->cell_max_x; cx++) {
+            for (int node = hash->buckets[cell_bucket(hash, cx, cy)]; node >= 0; node = hash->nodes[node].next) {
+                if (hash->nodes[node].entry == old_slot &&
+                    hash->nodes[node].cell_x == cx && hash->nodes[node].cell_y == cy) {
+                    hash->nodes[node].entry = new_slot;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// Retire la boîte à une position (la dernière boîte prend la place libérée)
+static void remove_entry_at(SpatialHash* hash, int slot) {
+    unlink_cells(hash, slot);
+    hash->sparse[ENTITY_INDEX(hash->entries[slot].entity)] = -1;
+
+    int last = --hash->entry_count;
+    if (slot < last) {
+        hash->entries[slot] = hash->entries[last];
+        hash->sparse[ENTITY_INDEX(hash->entries[slot].entity)] = slot;
+        relink_entry(hash, last, slot);
+    }
+}
+
+// Initialise une grille hachée
+SpatialHash* spatial_hash_init(float cell_size, int bucket_count) {
+    if (cell_size <= 0.0f || bucket_count <= 0) {
+        log_error("Paramètres de grille invalides (cellule %.1f, %d seaux)", cell_size, bucket_count);
+        return NULL;
+    }
+
+    SpatialHash* hash = (SpatialHash*)calloc(1, sizeof(SpatialHash));
+    if (!check_ptr(hash, LOG_LEVEL_ERROR, "Échec d'allocation de la grille hachée")) {
+        return NULL;
+    }
+
+    int buckets = 1;
+    while (buckets < bucket_count) {
+        buckets *= 2;
+    }
+
+    hash->cell_size = cell_size;
+    hash->inverse_cell_size = 1.0f / cell_size;
+    hash->bucket_mask = buckets - 1;
+    hash->free_node = -1;
+    hash->buckets = (int*)malloc(buckets * sizeof(int));
+    if (!check_ptr(hash->buckets, LOG_LEVEL_ERROR, "Échec d'allocation des seaux de la grille") ||
+        !ensure_sparse(hash, 0)) {
+        spatial_hash_shutdown(hash);
+        return NULL;
+    }
+    memset(hash->buckets, 0xFF, buckets * sizeof(int));
+
+    return hash;
+}
+
+// Libère une grille hachée
+void spatial_hash_shutdown(SpatialHash* hash) {
+    if (!hash) return;
+
+    free(hash->buckets);
+    free(hash->nodes);
+    free(hash->entries);
+    free(hash->sparse);
+    free(hash);
+}
+
+// Enregistre ou déplace la boîte d'une entité
+bool spatial_hash_update(SpatialHash* hash, EntityID entity_id,
+                         float min_x, float min_y, float max_x, float max_y) {
+    if (!hash || entity_id == INVALID_ENTITY_ID) return false;
+
+    int cell_min_x = cell_coord(hash, min_x);
+    int cell_min_y = cell_coord(hash, min_y);
+    int cell_max_x = cell_coord(hash, max_x);
+    int cell_max_y = cell_coord(hash, max_y);
+
+    int slot = find_entry(hash, entity_id);
+    if (slot >= 0) {
+        SpatialHashEntry* entry = &hash->entries[slot];
+        entry->min_x = min_x;
+        entry->min_y = min_y;
+        entry->max_x = max_x;
+        entry->max_y = max_y;
+
+        // Cas le plus courant : un petit déplacement sans changement de cellule
+        if (entry->cell_min_x == cell_min_x && entry->cell_min_y == cell_min_y &&
+            entry->cell_max_x == cell_max_x && entry->cell_max_y == cell_max_y) {
+            return true;
+        }
+        unlink_cells(hash, slot);
+    } else {
+        uint32_t index = ENTITY_INDEX(entity_id);
+        if (!ensure_sparse(hash, index)) return false;
+
+        // Index recyclé avant le retrait de l'ancienne génération : l'évincer,
+        // sinon sa boîte resterait chaînée sans plus pouvoir être retirée
+        if (hash->sparse[index] >= 0) {
+            remove_entry_at(hash, hash->sparse[index]);
+        }
+
+        if (hash->entry_count >= hash->entry_capacity) {
+            int new_capacity = hash->entry_capacity ? hash->entry_capacity * 2 : INITIAL_ENTRY_CAPACITY;
+            SpatialHashEntry* new_entries = (SpatialHashEntry*)realloc(
+                hash->entries, new_capacity * sizeof(SpatialHashEntry)
+            );
+            if (!check_ptr(new_entries, LOG_LEVEL_ERROR, "Échec d'agrandissement des boîtes de la grille")) {
+                return false;
+            }
+            hash->entries = new_entries;
+            hash->entry_capacity = new_capacity;
+        }
+
+        slot = hash->entry_count++;
+        SpatialHashEntry* entry = &hash->entries[slot];
+        entry->entity = entity_id;
+        entry->min_x = min_x;
+        entry->min_y = min_y;
+        entry->max_x = max_x;
+        entry->max_y = max_y;
+        entry->query_stamp = 0;
+        hash->sparse[index] = slot;
+    }
+
+    SpatialHashEntry* entry = &hash->entries[slot];
+    entry->cell_min_x = cell_min_x;
+    entry->cell_min_y = cell_min_y;
+    entry->cell_max_x = cell_max_x;
+    entry->cell_max_y = cell_max_y;
+
+    if (!link_cells(hash, slot)) {
+        // Ne pas laisser une boîte partiellement chaînée
+        spatial_hash_remove(hash, entity_id);
+        return false;
+    }
+    return true;
+}
+
+// Retire la boîte d'une entité
+bool spatial_hash_remove(SpatialHash* hash, EntityID entity_id) {
+    int slot = find_entry(hash, entity_id);
+    if (slot < 0) return false;
+
+    remove_entry_at(hash, slot);
+    return true;
+}
+
+// Indique si une entité est enregistrée
+bool spatial_hash_contains(const SpatialHash* hash, EntityID entity_id) {
+    return find_entry(hash, entity_id) >= 0;
+}
+
+// Ajoute une boîte au résultat si elle touche la zone
+static inline void collect_entry(SpatialHashEntry* entry, float min_x, float min_y, float max_x, float max_y,
+                                 EntityID* out_entities, int max_entities, int* found) {
+    if (entry->max_x < min_x || entry->min_x > max_x || entry->max_y < min_y || entry->min_y > max_y) return;
+
+    if (*found < max_entities) out_entities[*found] = entry->entity;
+    (*found)++;
+}
+
+// Trouve les entités dont la boîte touche une zone
+int spatial_hash_query(SpatialHash* hash, float min_x, float min_y, float max_x, float max_y,
+                       EntityID* out_entities, int max_entities) {
+    if (!hash || (!out_entities && max_entities > 0)) return 0;
+
+    int cell_min_x = cell_coord(hash, min_x);
+    int cell_min_y = cell_coord(hash, min_y);
+    int cell_max_x = cell_coord(hash, max_x);
+    int cell_max_y = cell_coord(hash, max_y);
+    int found = 0;
+
+    // Une zone couvrant plus de cellules qu'il n'y a de boîtes : un parcours direct coûte moins
+    int64_t cell_count = (int64_t)(cell_max_x - cell_min_x + 1) * (cell_max_y - cell_min_y + 1);
+    if (cell_count > hash->entry_count) {
+        for (int i = 0; i < hash->entry_count; i++) {
+            collect_entry(&hash->entries[i], min_x, min_y, max_x, max_y, out_entities, max_entities, &found);
+        }
+        return found;
+    }
+
+    // Le tampon permet de ne compter qu'une fois une boîte présente dans plusieurs cellules
+    uint32_t stamp = ++hash->query_stamp;
+    if (stamp == 0) {
+        for (int i = 0; i < hash->entry_count; i++) {
+            hash->entries[i].query_stamp = 0;
+        }
+        stamp = hash->query_stamp = 1;
+    }
+
+    for (int cy = cell_min_y; cy <= cell_max_y; cy++) {
+        for (int cx = cell_min_x; cx <= cell_max_x; cx++) {
+            for (int node = hash->buckets[cell_bucket(hash, cx, cy)]; node >= 0; node = hash->nodes[node].next) {
+                const SpatialHashNode* cell_node = &hash->nodes[node];
+                if (cell_node->cell_x != cx || cell_node->cell_y != cy) continue;
+
+                SpatialHashEntry* entry = &hash->entries[cell_node->entry];
+                if (entry->query_stamp == stamp) continue;
+                entry->query_stamp = stamp;
+
+                collect_entry(entry, min_x, min_y, max_x, max_y, out_entities, max_entities, &found);
+            }
+        }
+    }
+
+    return found;
+}
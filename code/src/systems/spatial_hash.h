@@ -0,0 +1,110 @@
+/**
+ * spatial_hash.h
+ * Grille uniforme hachée : recherche des boîtes englobantes voisines
+ */
+
+#ifndef SPATIAL_HASH_H
+#define SPATIAL_HASH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../core/entity.h"
+
+// Boîte d'une entité enregistrée dans la grille
+typedef struct {
+    EntityID entity;                  // Entité propriétaire
+    float min_x, min_y;               // Coin supérieur gauche de la boîte
+    float max_x, max_y;               // Coin inférieur droit de la boîte
+    int cell_min_x, cell_min_y;       // Première cellule couverte
+    int cell_max_x, cell_max_y;       // Dernière cellule couverte
+    uint32_t query_stamp;             // Dernière requête ayant visité la boîte (dédoublonnage)
+} SpatialHashEntry;
+
+// Présence d'une boîte dans une cellule (liste chaînée par seau)
+typedef struct {
+    int cell_x, cell_y;               // Cellule occupée
+    int entry;                        // Position de la boîte dans entries
+    int next;                         // Nœud suivant du seau ou de la liste libre (-1 en fin)
+} SpatialHashNode;
+
+// Grille uniforme de taille infinie, repliée sur un nombre fixe de seaux
+typedef struct {
+    float cell_size;                  // Côté d'une cellule en pixels
+    float inverse_cell_size;          // 1 / cell_size
+    int* buckets;                     // Premier nœud de chaque seau (-1 si vide)
+    int bucket_mask;                  // Nombre de seaux - 1 (puissance de 2)
+
+    SpatialHashNode* nodes;           // Nœuds de tous les seaux
+    int node_count;                   // Nombre de nœuds alloués (libres compris)
+    int node_capacity;                // Taille du tableau de nœuds
+    int free_node;                    // Premier nœud libre (-1 si aucun)
+
+    SpatialHashEntry* entries;        // Boîtes enregistrées (tableau dense)
+    int entry_count;                  // Nombre de boîtes
+    int entry_capacity;               // Taille du tableau de boîtes
+    int* sparse;                      // Index d'entité -> position dans entries (-1 si absente)
+    uint32_t sparse_capacity;         // Taille du tableau sparse
+
+    uint32_t query_stamp;             // Numéro de la dernière requête
+} SpatialHash;
+
+/**
+ * Initialise une grille hachée
+ * @param cell_size Côté d'une cellule (de l'ordre de la taille des plus gros objets mobiles)
+ * @param bucket_count Nombre de seaux (arrondi à la puissance de 2 supérieure)
+ * @return Pointeur vers la grille ou NULL en cas d'erreur
+ */
+SpatialHash* spatial_hash_init(float cell_size, int bucket_count);
+
+/**
+ * Libère une grille hachée
+ * @param hash Grille à libérer
+ */
+void spatial_hash_shutdown(SpatialHash* hash);
+
+/**
+ * Enregistre ou déplace la boîte d'une entité
+ * Si la boîte reste dans les mêmes cellules, seules ses coordonnées changent.
+ * Une ancienne génération encore enregistrée au même index d'entité est retirée.
+ * @param hash Grille hachée
+ * @param entity_id ID de l'entité
+ * @param min_x Bord gauche
+ * @param min_y Bord haut
+ * @param max_x Bord droit
+ * @param max_y Bord bas
+ * @return true si la boîte est enregistrée, false en cas d'erreur
+ */
+bool spatial_hash_update(SpatialHash* hash, EntityID entity_id,
+                         float min_x, float min_y, float max_x, float max_y);
+
+/**
+ * Retire la boîte d'une entité
+ * @param hash Grille hachée
+ * @param entity_id ID de l'entité
+ * @return true si la boîte a été retirée, false si elle n'était pas enregistrée
+ */
+bool spatial_hash_remove(SpatialHash* hash, EntityID entity_id);
+
+/**
+ * Indique si une entité est enregistrée
+ * @param hash Grille hachée
+ * @param entity_id ID de l'entité
+ * @return true si l'entité a une boîte dans la grille
+ */
+bool spatial_hash_contains(const SpatialHash* hash, EntityID entity_id);
+
+/**
+ * Trouve les entités dont la boîte touche une zone (chaque entité une seule fois)
+ * @param hash Grille hachée
+ * @param min_x Bord gauche de la zone
+ * @param min_y Bord haut de la zone
+ * @param max_x Bord droit de la zone
+ * @param max_y Bord bas de la zone
+ * @param out_entities Tableau pour stocker les entités trouvées
+ * @param max_entities Taille du tableau
+ * @return Nombre total d'entités trouvées (seules les max_entities premières sont écrites)
+ */
+int spatial_hash_query(SpatialHash* hash, float min_x, float min_y, float max_x, float max_y,
+                       EntityID* out_entities, int max_entities);
+
+#endif /* SPATIAL_HASH_H */
@@ -0,0 +1,445 @@
+/**
+ * sweep_and_prune.c
+ * Implémentation du balayage trié incrémental
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../systems/sweep_and_prune.h"
+#include "../utils/error_handler.h"
+
+// Capacité initiale du tableau sparse
+#define INITIAL_SPARSE_CAPACITY 1024
+
+// Capacité initiale des tableaux de boîtes, de paires et de chevauchements
+#define INITIAL_BODY_CAPACITY 64
+#define INITIAL_PAIR_CAPACITY 256
+
+// Nombre de boîtes ajoutées en une image au-delà duquel les paires sont reconstruites par un tri complet
+#define SWEEP_REBUILD_BATCH 64
+
+// Seau d'une paire
+static inline int pair_bucket(const SweepAndPrune* sap, EntityID a, EntityID b) {
+    uint32_t h = a * 2654435761u ^ b * 2246822519u;
+    return (int)((h ^ (h >> 15)) & (uint32_t)sap->pair_bucket_mask);
+}
+
+// Ordre des extrémités : à égalité, un bord gauche passe avant un bord droit,
+// ce qui garde le bord gauche d'une boîte de largeur nulle avant son bord droit
+static inline bool endpoint_less(const SweepEndpoint* a, const SweepEndpoint* b) {
+    if (a->value != b->value) return a->value < b->value;
+    return a->is_min && !b->is_min;
+}
+
+// Garantit que l'index sparse couvre un index d'entité
+static bool ensure_sparse(SweepAndPrune* sap, uint32_t index) {
+    if (index < sap->sparse_capacity) return true;
+
+    uint32_t new_capacity = sap->sparse_capacity ? sap->sparse_capacity : INITIAL_SPARSE_CAPACITY;
+    while (new_capacity <= index) {
+        new_capacity *= 2;
+    }
+
+    int* new_sparse = (int*)realloc(sap->sparse, new_capacity * sizeof(int));
+    if (!check_ptr(new_sparse, LOG_LEVEL_ERROR, "Échec d'agrandissement de l'index du balayage")) {
+        return false;
+    }
+
+    for (uint32_t i = sap->sparse_capacity; i < new_capacity; i++) {
+        new_sparse[i] = -1;
+    }
+    sap->sparse = new_sparse;
+    sap->sparse_capacity = new_capacity;
+    return true;
+}
+
+// Trouve la position de la boîte d'une entité
+static int find_body(const SweepAndPrune* sap, EntityID entity_id) {
+    if (!sap || entity_id == INVALID_ENTITY_ID) return -1;
+
+    uint32_t index = ENTITY_INDEX(entity_id);
+    if (index >= sap->sparse_capacity) return -1;
+
+    int slot = sap->sparse[index];
+    if (slot < 0 || sap->bodies[slot].entity != entity_id) return -1;
+    return slot;
+}
+
+// Agrandit le tableau des paires et redistribue les seaux (autant de seaux que de places)
+static bool grow_pairs(SweepAndPrune* sap) {
+    int new_capacity = sap->pair_capacity ? sap->pair_capacity * 2 : INITIAL_PAIR_CAPACITY;
+
+    SweepPair* new_pairs = (SweepPair*)realloc(sap->pairs, new_capacity * sizeof(SweepPair));
+    if (!check_ptr(new_pairs, LOG_LEVEL_ERROR, "Échec d'agrandissement des paires du balayage")) {
+        return false;
+    }
+    sap->pairs = new_pairs;
+
+    int* new_buckets = (int*)malloc(new_capacity * sizeof(int));
+    if (!check_ptr(new_buckets, LOG_LEVEL_ERROR, "Échec d'agrandissement des seaux du balayage")) {
+        return false;
+    }
+    free(sap->pair_buckets);
+    sap->pair_buckets = new_buckets;
+    sap->pair_bucket_mask = new_capacity - 1;
+    sap->pair_capacity = new_capacity;
+
+    for (int i = 0; i < new_capacity; i++) {
+        sap->pair_buckets[i] = -1;
+    }
+    for (int i = 0; i < sap->pair_count; i++) {
+        int bucket = pair_bucket(sap, sap->pairs[i].a, sap->pairs[i].b);
+        sap->pairs[i].next = sap->pair_buckets[bucket];
+        sap->pair_buckets[bucket] = i;
+    }
+    return true;
+}
+
+// Décroche une paire de la chaîne de son seau
+static void unlink_pair(SweepAndPrune* sap, int pair) {
+    int* link = &sap->pair_buckets[pair_bucket(sap, sap->pairs[pair].a, sap->pairs[pair].b)];
+    while (*link != pair) {
+        link = &sap->pairs[*link].next;
+    }
+    *link = sap->pairs[pair].next;
+}
+
+// Retire une paire par sa position (la dernière paire comble le trou)
+static void remove_pair_at(SweepAndPrune* sap, int pair) {
+    unlink_pair(sap, pair);
+
+    int last = sap->pair_count - 1;
+    if (pair != last) {
+        unlink_pair(sap, last);
+        sap->pairs[pair] = sap->pairs[last];
+
+        int bucket = pair_bucket(sap, sap->pairs[pair].a, sap->pairs[pair].b);
+        sap->pairs[pair].next = sap->pair_buckets[bucket];
+        sap->pair_buckets[bucket] = pair;
+    }
+    sap->pair_count--;
+}
+
+// Ajoute une paire si elle n'existe pas déjà
+static bool add_pair(SweepAndPrune* sap, EntityID a, EntityID b) {
+    if (a > b) {
+        EntityID swap = a;
+        a = b;
+        b = swap;
+    }
+
+    for (int i = sap->pair_buckets[pair_bucket(sap, a, b)]; i >= 0; i = sap->pairs[i].next) {
+        if (sap->pairs[i].a == a && sap->pairs[i].b == b) return true;
+    }
+
+    if (sap->pair_count >= sap->pair_capacity && !grow_pairs(sap)) {
+        return false;
+    }
+
+    int bucket = pair_bucket(sap, a, b);
+    int pair = sap->pair_count++;
+    sap->pairs[pair].a = a;
+    sap->pairs[pair].b = b;
+    sap->pairs[pair].next = sap->pair_buckets[bucket];
+    sap->pair_buckets[bucket] = pair;
+    return true;
+}
+
+// Retire une paire si elle existe
+static void remove_pair(SweepAndPrune* sap, EntityID a, EntityID b) {
+    if (a > b) {
+        EntityID swap = a;
+        a = b;
+        b = swap;
+    }
+
+    for (int i = sap->pair_buckets[pair_bucket(sap, a, b)]; i >= 0; i = sap->pairs[i].next) {
+        if (sap->pairs[i].a == a && sap->pairs[i].b == b) {
+            remove_pair_at(sap, i);
+            return;
+        }
+    }
+}
+
+// Place une extrémité à une position et tient à jour l'index de sa boîte
+static inline void place_endpoint(SweepAndPrune* sap, int position, const SweepEndpoint* endpoint) {
+    sap->endpoints[position] = *endpoint;
+
+    SweepBody* body = &sap->bodies[endpoint->body];
+    if (endpoint->is_min) {
+        body->min_endpoint = position;
+    } else {
+        body->max_endpoint = position;
+    }
+}
+
+// Initialise un balayage vide
+SweepAndPrune* sweep_and_prune_init(void) {
+    SweepAndPrune* sap = (SweepAndPrune*)calloc(1, sizeof(SweepAndPrune));
+    if (!check_ptr(sap, LOG_LEVEL_ERROR, "Échec d'allocation du balayage")) {
+        return NULL;
+    }
+
+    if (!ensure_sparse(sap, 0) || !grow_pairs(sap)) {
+        sweep_and_prune_shutdown(sap);
+        return NULL;
+    }
+    return sap;
+}
+
+// Libère un balayage
+void sweep_and_prune_shutdown(SweepAndPrune* sap) {
+    if (!sap) return;
+
+    free(sap->bodies);
+    free(sap->sparse);
+    free(sap->endpoints);
+    free(sap->pairs);
+    free(sap->pair_buckets);
+    free(sap->overlaps);
+    free(sap);
+}
+
+// Retire la boîte à une position et ses paires
+static void remove_body_at(SweepAndPrune* sap, int slot) {
+    EntityID entity_id = sap->bodies[slot].entity;
+
+    // Retirer les paires de la boîte (à rebours : la dernière paire comble le trou)
+    for (int i = sap->pair_count - 1; i >= 0; i--) {
+        if (sap->pairs[i].a == entity_id || sap->pairs[i].b == entity_id) {
+            remove_pair_at(sap, i);
+        }
+    }
+
+    // Retirer ses deux extrémités en conservant l'ordre des autres
+    int endpoint_count = 2 * sap->body_count;
+    int write = sap->bodies[slot].min_endpoint;
+    for (int read = write; read < endpoint_count; read++) {
+        if (sap->endpoints[read].body == slot) continue;
+        place_endpoint(sap, write++, &sap->endpoints[read]);
+    }
+
+    // La dernière boîte comble le trou ; ses extrémités changent de propriétaire
+    int last = sap->body_count - 1;
+    if (slot != last) {
+        sap->bodies[slot] = sap->bodies[last];
+        sap->endpoints[sap->bodies[slot].min_endpoint].body = slot;
+        sap->endpoints[sap->bodies[slot].max_endpoint].body = slot;
+        sap->sparse[ENTITY_INDEX(sap->bodies[slot].entity)] = slot;
+    }
+
+    sap->body_count--;
+    sap->sparse[ENTITY_INDEX(entity_id)] = -1;
+}
+
+// Enregistre ou déplace la boîte d'une entité
+bool sweep_and_prune_set(SweepAndPrune* sap, EntityID entity_id,
+                         float min_x, float min_y, float max_x, float max_y) {
+    if (!sap || entity_id == INVALID_ENTITY_ID) return false;
+
+    int slot = find_body(sap, entity_id);
+    if (slot >= 0) {
+        // Seules les valeurs changent : le tri les replacera à la prochaine mise à jour
+        SweepBody* body = &sap->bodies[slot];
+        sap->endpoints[body->min_endpoint].value = min_x;
+        sap->endpoints[body->max_endpoint].value = max_x;
+        body->min_y = min_y;
+        body->max_y = max_y;
+        return true;
+    }
+
+    uint32_t index = ENTITY_INDEX(entity_id);
+    if (!ensure_sparse(sap, index)) return false;
+
+    // Index recyclé avant le retrait de l'ancienne génération : l'évincer avec ses paires,
+    // sinon sa boîte resterait triée sans plus pouvoir être retirée
+    if (sap->sparse[index] >= 0) {
+        remove_body_at(sap, sap->sparse[index]);
+    }
+
+    if (sap->body_count >= sap->body_capacity) {
+        int new_capacity = sap->body_capacity ? sap->body_capacity * 2 : INITIAL_BODY_CAPACITY;
+
+        SweepBody* new_bodies = (SweepBody*)realloc(sap->bodies, new_capacity * sizeof(SweepBody));
+        if (!check_ptr(new_bodies, LOG_LEVEL_ERROR, "Échec d'agrandissement des boîtes du balayage")) {
+            return false;
+        }
+        sap->bodies = new_bodies;
+
+        SweepEndpoint* new_endpoints = (SweepEndpoint*)realloc(
+            sap->endpoints, 2 * new_capacity * sizeof(SweepEndpoint)
+        );
+        if (!check_ptr(new_endpoints, LOG_LEVEL_ERROR, "Échec d'agrandissement des extrémités du balayage")) {
+            return false;
+        }
+        sap->endpoints = new_endpoints;
+        sap->body_capacity = new_capacity;
+    }
+
+    // Ajoutée en fin de tableau, la boîte ne chevauche encore personne :
+    // le tri par insertion créera ses paires en la remontant à sa place
+    slot = sap->body_count++;
+    SweepBody* body = &sap->bodies[slot];
+    body->entity = entity_id;
+    body->min_y = min_y;
+    body->max_y = max_y;
+
+    SweepEndpoint min_endpoint = { min_x, slot, true };
+    SweepEndpoint max_endpoint = { max_x, slot, false };
+    place_endpoint(sap, 2 * slot, &min_endpoint);
+    place_endpoint(sap, 2 * slot + 1, &max_endpoint);
+
+    sap->sparse[index] = slot;
+    sap->added_count++;
+    return true;
+}
+
+// Retire la boîte d'une entité et ses paires
+bool sweep_and_prune_remove(SweepAndPrune* sap, EntityID entity_id) {
+    int slot = find_body(sap, entity_id);
+    if (slot < 0) return false;
+
+    remove_body_at(sap, slot);
+    return true;
+}
+
+// Indique si une entité est enregistrée
+bool sweep_and_prune_contains(const SweepAndPrune* sap, EntityID entity_id) {
+    return find_body(sap, entity_id) >= 0;
+}
+
+// Tri des extrémités pour la reconstruction
+static int compare_endpoints(const void* a, const void* b) {
+    const SweepEndpoint* ea = (const SweepEndpoint*)a;
+    const SweepEndpoint* eb = (const SweepEndpoint*)b;
+    return endpoint_less(ea, eb) ? -1 : (endpoint_less(eb, ea) ? 1 : 0);
+}
+
+// Reconstruit les paires par un tri complet puis un balayage (chargement de carte, apparitions en masse)
+static bool rebuild_pairs(SweepAndPrune* sap) {
+    int endpoint_count = 2 * sap->body_count;
+    qsort(sap->endpoints, endpoint_count, sizeof(SweepEndpoint), compare_endpoints);
+
+    for (int i = 0; i < sap->pair_capacity; i++) {
+        sap->pair_buckets[i] = -1;
+    }
+    sap->pair_count = 0;
+
+    // Boîtes dont le bord gauche est passé mais pas encore le bord droit
+    int* active = (int*)malloc((sap->body_count + 1) * sizeof(int));
+    if (!check_ptr(active, LOG_LEVEL_ERROR, "Échec d'allocation pour la reconstruction du balayage")) {
+        return false;
+    }
+
+    bool ok = true;
+    int active_count = 0;
+    for (int i = 0; i < endpoint_count; i++) {
+        SweepEndpoint endpoint = sap->endpoints[i];
+        place_endpoint(sap, i, &endpoint);
+
+        if (endpoint.is_min) {
+            EntityID entity = sap->bodies[endpoint.body].entity;
+            for (int k = 0; k < active_count; k++) {
+                ok &= add_pair(sap, entity, sap->bodies[active[k]].entity);
+            }
+            active[active_count++] = endpoint.body;
+        } else {
+            for (int k = 0; k < active_count; k++) {
+                if (active[k] == endpoint.body) {
+                    active[k] = active[--active_count];
+                    break;
+                }
+            }
+        }
+    }
+
+    free(active);
+    return ok;
+}
+
+// Met à jour les paires par tri par insertion depuis l'ordre de l'image précédente
+static bool sort_pairs(SweepAndPrune* sap) {
+    bool failed = false;
+    int endpoint_count = 2 * sap->body_count;
+
+    // Presque linéaire quand les boîtes bougent peu d'une image à l'autre
+    for (int i = 1; i < endpoint_count; i++) {
+        SweepEndpoint moving = sap->endpoints[i];
+        int j = i - 1;
+
+        while (j >= 0 && endpoint_less(&moving, &sap->endpoints[j])) {
+            const SweepEndpoint* passed = &sap->endpoints[j];
+
+            // Un bord gauche qui double un bord droit ouvre un chevauchement,
+            // un bord droit qui double un bord gauche le ferme
+            if (passed->body != moving.body && passed->is_min != moving.is_min) {
+                EntityID a = sap->bodies[moving.body].entity;
+                EntityID b = sap->bodies[passed->body].entity;
+                if (moving.is_min) {
+                    failed |= !add_pair(sap, a, b);
+                } else {
+                    remove_pair(sap, a, b);
+                }
+            }
+
+            place_endpoint(sap, j + 1, passed);
+            j--;
+        }
+
+        if (j + 1 != i) {
+            place_endpoint(sap, j + 1, &moving);
+        }
+    }
+
+    return !failed;
+}
+
+// Retrie les extrémités et met à jour les paires
+int sweep_and_prune_update(SweepAndPrune* sap) {
+    if (!sap) return -1;
+
+    bool failed = sap->added_count > SWEEP_REBUILD_BATCH ? !rebuild_pairs(sap) : !sort_pairs(sap);
+    sap->added_count = 0;
+
+    // Les paires incluent les boîtes qui se touchent : ne garder que les chevauchements stricts
+    if (sap->overlap_capacity < sap->pair_capacity) {
+        SweepOverlap* new_overlaps = (SweepOverlap*)realloc(
+            sap->overlaps, sap->pair_capacity * sizeof(SweepOverlap)
+        );
+        if (!check_ptr(new_overlaps, LOG_LEVEL_ERROR, "Échec d'agrandissement des chevauchements du balayage")) {
+            sap->overlap_count = 0;
+            return -1;
+        }
+        sap->overlaps = new_overlaps;
+        sap->overlap_capacity = sap->pair_capacity;
+    }
+
+    sap->overlap_count = 0;
+    for (int i = 0; i < sap->pair_count; i++) {
+        // Une paire dont une entité n'a plus sa boîte est abandonnée sans être lue
+        int slot_a = find_body(sap, sap->pairs[i].a);
+        int slot_b = find_body(sap, sap->pairs[i].b);
+        if (slot_a < 0 || slot_b < 0) {
+            remove_pair_at(sap, i--);
+            continue;
+        }
+
+        const SweepBody* a = &sap->bodies[slot_a];
+        const SweepBody* b = &sap->bodies[slot_b];
+        if (a->max_y <= b->min_y || a->min_y >= b->max_y) continue;
+        if (sap->endpoints[a->max_endpoint].value <= sap->endpoints[b->min_endpoint].value ||
+            sap->endpoints[a->min_endpoint].value >= sap->endpoints[b->max_endpoint].value) {
+            continue;
+        }
+
+        sap->overlaps[sap->overlap_count].a = sap->pairs[i].a;
+        sap->overlaps[sap->overlap_count].b = sap->pairs[i].b;
+        sap->overlap_count++;
+    }
+
+    if (failed) {
+        log_error("Paires du balayage incomplètes faute de mémoire");
+        return -1;
+    }
+    return sap->overlap_count;
+}
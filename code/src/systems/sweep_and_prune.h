@@ -0,0 +1,117 @@
+/**
+ * sweep_and_prune.h
+ * Balayage trié incrémental : paires de boîtes qui se chevauchent
+ */
+
+#ifndef SWEEP_AND_PRUNE_H
+#define SWEEP_AND_PRUNE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../core/entity.h"
+
+// Extrémité d'une boîte sur l'axe X
+typedef struct {
+    float value;              // Coordonnée X de l'extrémité
+    int body;                 // Boîte propriétaire (position dans bodies)
+    bool is_min;              // Bord gauche (true) ou droit (false)
+} SweepEndpoint;
+
+// Boîte enregistrée dans le balayage
+typedef struct {
+    EntityID entity;          // Entité propriétaire
+    float min_y, max_y;       // Étendue verticale (l'étendue horizontale est dans les extrémités)
+    int min_endpoint;         // Position du bord gauche dans endpoints
+    int max_endpoint;         // Position du bord droit dans endpoints
+} SweepBody;
+
+// Paire de boîtes dont les intervalles X se chevauchent ou se touchent (conservée d'une image à l'autre)
+typedef struct {
+    EntityID a, b;            // Entités de la paire (a < b)
+    int next;                 // Paire suivante du même seau (-1 en fin)
+} SweepPair;
+
+// Paire de boîtes qui se chevauchent sur les deux axes
+typedef struct {
+    EntityID a, b;            // Entités de la paire (a < b)
+} SweepOverlap;
+
+// Balayage trié le long de l'axe X
+typedef struct {
+    SweepBody* bodies;               // Boîtes enregistrées (tableau dense)
+    int body_count;                  // Nombre de boîtes
+    int body_capacity;               // Taille du tableau de boîtes
+    int* sparse;                     // Index d'entité -> position dans bodies (-1 si absente)
+    uint32_t sparse_capacity;        // Taille du tableau sparse
+
+    SweepEndpoint* endpoints;        // Extrémités triées (2 par boîte)
+    int added_count;                 // Boîtes ajoutées depuis la dernière mise à jour
+
+    SweepPair* pairs;                // Paires chevauchantes sur X
+    int pair_count;                  // Nombre de paires
+    int pair_capacity;               // Taille du tableau de paires
+    int* pair_buckets;               // Première paire de chaque seau (-1 si vide)
+    int pair_bucket_mask;            // Nombre de seaux - 1 (puissance de 2)
+
+    SweepOverlap* overlaps;          // Paires chevauchantes sur X et Y à la dernière mise à jour
+    int overlap_count;               // Nombre de paires chevauchantes
+    int overlap_capacity;            // Taille du tableau des chevauchements
+} SweepAndPrune;
+
+/**
+ * Initialise un balayage vide
+ * @return Pointeur vers le balayage ou NULL en cas d'erreur
+ */
+SweepAndPrune* sweep_and_prune_init(void);
+
+/**
+ * Libère un balayage
+ * @param sap Balayage à libérer
+ */
+void sweep_and_prune_shutdown(SweepAndPrune* sap);
+
+/**
+ * Enregistre ou déplace la boîte d'une entité
+ * Le tri et les paires ne sont mis à jour qu'au prochain sweep_and_prune_update.
+ * Une ancienne génération encore enregistrée au même index d'entité est retirée avec ses paires.
+ * @param sap Balayage
+ * @param entity_id ID de l'entité
+ * @param min_x Bord gauche
+ * @param min_y Bord haut
+ * @param max_x Bord droit
+ * @param max_y Bord bas
+ * @return true si la boîte est enregistrée, false en cas d'erreur
+ */
+bool sweep_and_prune_set(SweepAndPrune* sap, EntityID entity_id,
+                         float min_x, float min_y, float max_x, float max_y);
+
+/**
+ * Retire la boîte d'une entité et ses paires
+ * @param sap Balayage
+ * @param entity_id ID de l'entité
+ * @return true si la boîte a été retirée, false si elle n'était pas enregistrée
+ */
+bool sweep_and_prune_remove(SweepAndPrune* sap, EntityID entity_id);
+
+/**
+ * Indique si une entité est enregistrée
+ * @param sap Balayage
+ * @param entity_id ID de l'entité
+ * @return true si l'entité a une boîte dans le balayage
+ */
+bool sweep_and_prune_contains(const SweepAndPrune* sap, EntityID entity_id);
+
+/**
+ * Retrie les extrémités et met à jour les paires
+ * Le tri par insertion repart de l'ordre de l'image précédente : chaque échange
+ * d'extrémités ajoute ou retire une paire, sans reconstruire l'ensemble.
+ * Après l'ajout d'un grand nombre de boîtes, les paires sont plutôt reconstruites
+ * par un tri complet suivi d'un balayage.
+ * Les paires chevauchantes sur les deux axes sont ensuite écrites dans overlaps.
+ * Une paire dont l'une des entités n'a plus de boîte est abandonnée.
+ * @param sap Balayage
+ * @return Nombre de paires chevauchantes, ou -1 en cas d'erreur
+ */
+int sweep_and_prune_update(SweepAndPrune* sap);
+
+#endif /* SWEEP_AND_PRUNE_H */
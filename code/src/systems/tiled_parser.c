@@ -890,132 +890,187 @@ Map* tiled_convert_to_game_map(TiledMap* tiled_map, ResourceManager* resource_ma
     // Libérer les IDs de texture
     if (texture_ids) free(texture_ids);
     
+    // Traversabilité des chunks, utilisée par la physique pour les tests tuiles contre boîtes
+    for (int i = 0; i < chunks_x * chunks_y; i++) {
+        world_chunk_build_walkability(game_map->chunks[i]);
+    }
+    
     log_info("Carte convertie avec succès (%dx%d chunks)", chunks_x, chunks_y);
     return game_map;
 }
 
+// Détermine le type de collision d'un objet Tiled à partir de ses propriétés
+static CollisionType tiled_object_collision_type(TiledObject* object) {
+    TiledProperty* trigger_prop = tiled_get_property(object->properties, object->property_count, "is_trigger");
+    if (trigger_prop && strcmp(trigger_prop->value, "true") == 0) {
+        return COLLISION_TRIGGER;
+    }
+    
+    TiledProperty* collision_prop = tiled_get_property(object->properties, object->property_count, "collision_type");
+    if (collision_prop) {
+        if (strcmp(collision_prop->value, "dynamic") == 0) {
+            return COLLISION_DYNAMIC;
+        } else if (strcmp(collision_prop->value, "trigger") == 0) {
+            return COLLISION_TRIGGER;
+        }
+    }
+    
+    return COLLISION_STATIC;
+}
+
+// Ajoute les composants propres au type d'un objet Tiled
+static void tiled_add_object_components(EntityManager* entity_manager, EntityID entity_id, TiledObject* object) {
+    if (!object->type || strlen(object->type) == 0) return;
+    
+    if (strcmp(object->type, "player_spawn") == 0) {
+        // Point de spawn du joueur, pas besoin d'ajouter d'autres composants
+    } else if (strcmp(object->type, "npc") == 0) {
+        // Si c'est un NPC, ajouter le composant NPC
+        // Pas encore implémenté
+    } else if (strcmp(object->type, "item") == 0) {
+        // Si c'est un item, ajouter le composant Item
+        TiledProperty* item_id_prop = tiled_get_property(object->properties, object->property_count, "item_id");
+        int item_id = item_id_prop ? atoi(item_id_prop->value) : 0;
+        
+        TiledProperty* stack_size_prop = tiled_get_property(object->properties, object->property_count, "stack_size");
+        int stack_size = stack_size_prop ? atoi(stack_size_prop->value) : 1;
+        
+        ItemComponent* item = (ItemComponent*)entity_emplace_component(
+            entity_manager, entity_id, COMPONENT_ITEM
+        );
+        if (item) {
+            init_item_component(item, entity_id, item_id, stack_size);
+        } else {
+            log_error("Échec d'ajout du composant Item à l'entité %u", entity_id);
+        }
+    } else if (strcmp(object->type, "interactable") == 0) {
+        // Si c'est un objet interactif, ajouter le composant Interactable
+        TiledProperty* interaction_type_prop = tiled_get_property(object->properties, object->property_count, "interaction_type");
+        int interaction_type = interaction_type_prop ? atoi(interaction_type_prop->value) : 0;
+        
+        TiledProperty* interaction_radius_prop = tiled_get_property(object->properties, object->property_count, "interaction_radius");
+        float interaction_radius = interaction_radius_prop ? atof(interaction_radius_prop->value) : 32.0f;
+        
+        InteractableComponent* interactable = (InteractableComponent*)entity_emplace_component(
+            entity_manager, entity_id, COMPONENT_INTERACTABLE
+        );
+        
+        if (interactable) {
+            init_interactable_component(
+                interactable,
+                entity_id, 
+                interaction_type, 
+                interaction_radius
+            );
+        } else {
+            log_error("Échec d'ajout du composant Interactable à l'entité %u", entity_id);
+        }
+    }
+    // D'autres types peuvent être ajoutés ici
+}
+
 // Fonction pour créer des entités à partir des objets d'une carte Tiled
 int tiled_create_entities(TiledMap* tiled_map, EntityManager* entity_manager, float origin_x, float origin_y) {
     if (!tiled_map || !entity_manager) return -1;
     
-    int created_entities = 0;
+    // Compter les objets de toutes les couches pour les créer en un seul lot
+    int object_count = 0;
+    for (int group_index = 0; group_index < tiled_map->object_group_count; group_index++) {
+        TiledObjectGroup* group = tiled_map->object_groups[group_index];
+        if (!group) continue;
+        
+        for (int obj_index = 0; obj_index < group->object_count; obj_index++) {
+            if (group->objects[obj_index]) object_count++;
+        }
+    }
+    
+    if (object_count == 0) {
+        log_info("Aucun objet à créer dans la carte Tiled");
+        return 0;
+    }
     
-    // Parcourir chaque couche d'objets
+    TiledObject** objects = (TiledObject**)malloc(object_count * sizeof(TiledObject*));
+    EntityID* entity_ids = (EntityID*)malloc(object_count * sizeof(EntityID));
+    if (!check_ptr(objects, LOG_LEVEL_ERROR, "Échec d'allocation de la liste des objets Tiled") ||
+        !check_ptr(entity_ids, LOG_LEVEL_ERROR, "Échec d'allocation des IDs d'entités Tiled")) {
+        free(objects);
+        free(entity_ids);
+        return 0;
+    }
+    
+    int object_index = 0;
     for (int group_index = 0; group_index < tiled_map->object_group_count; group_index++) {
         TiledObjectGroup* group = tiled_map->object_groups[group_index];
         if (!group) continue;
         
-        // Parcourir chaque objet
         for (int obj_index = 0; obj_index < group->object_count; obj_index++) {
-            TiledObject* object = group->objects[obj_index];
-            if (!object) continue;
-            
-            // Créer une nouvelle entité
-            EntityID entity_id = entity_create(entity_manager);
-            if (entity_id == INVALID_ENTITY_ID) {
-                log_error("Échec de création d'une entité pour l'objet %s", object->name);
-                continue;
-            }
-            
-            // Ajouter un composant Transform
-            TransformComponent* transform = create_transform_component(
-                entity_id, 
+            if (group->objects[obj_index]) objects[object_index++] = group->objects[obj_index];
+        }
+    }
+    
+    // Créer toutes les entités avec leurs composants Transform et Collider en une passe
+    ComponentMask mask = COMPONENT_BIT(COMPONENT_TRANSFORM) | COMPONENT_BIT(COMPONENT_COLLIDER);
+    if (!entity_create_batch(entity_manager, object_count, mask, entity_ids)) {
+        log_error("Échec de création des %d entités de la carte Tiled", object_count);
+        free(objects);
+        free(entity_ids);
+        return 0;
+    }
+    
+    // Remplir les Transform par plages contiguës
+    for (int i = 0; i < object_count; ) {
+        TransformComponent* transforms;
+        int span = entity_batch_span(entity_manager, entity_ids + i, object_count - i,
+                                     COMPONENT_TRANSFORM, (void**)&transforms);
+        if (span == 0) break;
+        
+        for (int k = 0; k < span; k++) {
+            TiledObject* object = objects[i + k];
+            init_transform_component(
+                &transforms[k],
+                entity_ids[i + k], 
                 origin_x + object->x + object->width / 2, 
                 origin_y + object->y + object->height / 2
             );
-            
-            if (transform && entity_add_component(entity_manager, entity_id, transform)) {
-                // Ok
-            } else {
-                log_error("Échec d'ajout du composant Transform à l'entité %u", entity_id);
-                entity_destroy(entity_manager, entity_id);
-                free(transform);
-                continue;
-            }
-            
-            // Ajouter un composant Collider si ce n'est pas un déclencheur
-            TiledProperty* trigger_prop = tiled_get_property(object->properties, object->property_count, "is_trigger");
-            bool is_trigger = trigger_prop && strcmp(trigger_prop->value, "true") == 0;
-            
-            CollisionType collision_type = COLLISION_STATIC;
-            if (is_trigger) {
-                collision_type = COLLISION_TRIGGER;
-            } else {
-                TiledProperty* collision_prop = tiled_get_property(object->properties, object->property_count, "collision_type");
-                if (collision_prop) {
-                    if (strcmp(collision_prop->value, "dynamic") == 0) {
-                        collision_type = COLLISION_DYNAMIC;
-                    } else if (strcmp(collision_prop->value, "trigger") == 0) {
-                        collision_type = COLLISION_TRIGGER;
-                    }
-                }
-            }
-            
-            ColliderComponent* collider = create_collider_component(
-                entity_id, 
+        }
+        i += span;
+    }
+    
+    // Remplir les Collider de la même façon
+    for (int i = 0; i < object_count; ) {
+        ColliderComponent* colliders;
+        int span = entity_batch_span(entity_manager, entity_ids + i, object_count - i,
+                                     COMPONENT_COLLIDER, (void**)&colliders);
+        if (span == 0) break;
+        
+        for (int k = 0; k < span; k++) {
+            TiledObject* object = objects[i + k];
+            init_collider_component(
+                &colliders[k],
+                entity_ids[i + k], 
                 object->width, 
                 object->height,
-                collision_type
+                tiled_object_collision_type(object)
             );
             
-            if (collider && entity_add_component(entity_manager, entity_id, collider)) {
-                // Ok
-            } else {
-                log_error("Échec d'ajout du composant Collider à l'entité %u", entity_id);
-                free(collider);
-                // Ne pas détruire l'entité, elle peut être utile même sans collider
+            // Les triggers portent aussi un tag : les filtrer ne demande que le masque
+            // (poser un tag ne déplace aucun composant, la plage reste valide)
+            if (colliders[k].type == COLLISION_TRIGGER) {
+                entity_set_tag(entity_manager, entity_ids[i + k], COMPONENT_TAG_TRIGGER, true);
             }
-            
-            // Ajouter d'autres composants en fonction du type d'objet
-            if (object->type && strlen(object->type) > 0) {
-                if (strcmp(object->type, "player_spawn") == 0) {
-                    // Point de spawn du joueur, pas besoin d'ajouter d'autres composants
-                } else if (strcmp(object->type, "npc") == 0) {
-                    // Si c'est un NPC, ajouter le composant NPC
-                    // Pas encore implémenté
-                } else if (strcmp(object->type, "item") == 0) {
-                    // Si c'est un item, ajouter le composant Item
-                    TiledProperty* item_id_prop = tiled_get_property(object->properties, object->property_count, "item_id");
-                    int item_id = item_id_prop ? atoi(item_id_prop->value) : 0;
-                    
-                    TiledProperty* stack_size_prop = tiled_get_property(object->properties, object->property_count, "stack_size");
-                    int stack_size = stack_size_prop ? atoi(stack_size_prop->value) : 1;
-                    
-                    ItemComponent* item = create_item_component(entity_id, item_id, stack_size);
-                    if (item && entity_add_component(entity_manager, entity_id, item)) {
-                        // Ok
-                    } else {
-                        log_error("Échec d'ajout du composant Item à l'entité %u", entity_id);
-                        free(item);
-                    }
-                } else if (strcmp(object->type, "interactable") == 0) {
-                    // Si c'est un objet interactif, ajouter le composant Interactable
-                    TiledProperty* interaction_type_prop = tiled_get_property(object->properties, object->property_count, "interaction_type");
-                    int interaction_type = interaction_type_prop ? atoi(interaction_type_prop->value) : 0;
-                    
-                    TiledProperty* interaction_radius_prop = tiled_get_property(object->properties, object->property_count, "interaction_radius");
-                    float interaction_radius = interaction_radius_prop ? atof(interaction_radius_prop->value) : 32.0f;
-                    
-                    InteractableComponent* interactable = create_interactable_component(
-                        entity_id, 
-                        interaction_type, 
-                        interaction_radius
-                    );
-                    
-                    if (interactable && entity_add_component(entity_manager, entity_id, interactable)) {
-                        // Ok
-                    } else {
-                        log_error("Échec d'ajout du composant Interactable à l'entité %u", entity_id);
-                        free(interactable);
-                    }
-                }
-                // D'autres types peuvent être ajoutés ici
-            }
-            
-            created_entities++;
         }
+        i += span;
+    }
+    
+    // Ajouter ensuite les composants propres à chaque type d'objet
+    // (en stockage par archétypes, ces ajouts déplacent les entités : les plages ne sont plus valides)
+    for (int i = 0; i < object_count; i++) {
+        tiled_add_object_components(entity_manager, entity_ids[i], objects[i]);
     }
     
-    log_info("Créé %d entités à partir de la carte Tiled", created_entities);
-    return created_entities;
+    free(objects);
+    free(entity_ids);
+    
+    log_info("Créé %d entités à partir de la carte Tiled", object_count);
+    return object_count;
 }
\ No newline at end of file
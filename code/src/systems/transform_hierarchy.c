@@ -0,0 +1,346 @@
+/**
+ * transform_hierarchy.c
+ * Implémentation de la hiérarchie de transformations
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../systems/transform_hierarchy.h"
+#include "../utils/error_handler.h"
+
+// Capacité initiale du tableau sparse
+#define INITIAL_SPARSE_CAPACITY 1024
+
+// Capacité initiale du tableau de nœuds
+#define INITIAL_NODE_CAPACITY 64
+
+// Degrés vers radians
+#define DEG_TO_RAD 0.017453292519943295f
+
+// Transformation identité
+static const AffineTransform identity_transform = { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f };
+
+// Construit la matrice locale d'un Transform (échelle, puis rotation, puis translation)
+static AffineTransform local_from_component(const TransformComponent* transform) {
+    float radians = transform->rotation * DEG_TO_RAD;
+    float cos_r = cosf(radians);
+    float sin_r = sinf(radians);
+
+    AffineTransform local;
+    local.a = cos_r * transform->scale_x;
+    local.b = sin_r * transform->scale_x;
+    local.c = -sin_r * transform->scale_y;
+    local.d = cos_r * transform->scale_y;
+    local.tx = transform->x;
+    local.ty = transform->y;
+    return local;
+}
+
+// Compose deux transformations : d'abord local, puis parent
+static AffineTransform compose(const AffineTransform* parent, const AffineTransform* local) {
+    AffineTransform world;
+    world.a = parent->a * local->a + parent->c * local->b;
+    world.b = parent->b * local->a + parent->d * local->b;
+    world.c = parent->a * local->c + parent->c * local->d;
+    world.d = parent->b * local->c + parent->d * local->d;
+    world.tx = parent->a * local->tx + parent->c * local->ty + parent->tx;
+    world.ty = parent->b * local->tx + parent->d * local->ty + parent->ty;
+    return world;
+}
+
+// Garantit que l'index sparse couvre un index d'entité
+static bool ensure_sparse(TransformHierarchy* hierarchy, uint32_t index) {
+    if (index < hierarchy->sparse_capacity) return true;
+
+    uint32_t new_capacity = hierarchy->sparse_capacity ? hierarchy->sparse_capacity : INITIAL_SPARSE_CAPACITY;
+    while (new_capacity <= index) {
+        new_capacity *= 2;
+    }
+
+    int* new_sparse = (int*)realloc(hierarchy->sparse, new_capacity * sizeof(int));
+    if (!check_ptr(new_sparse, LOG_LEVEL_ERROR, "Échec d'agrandissement de l'index de la hiérarchie")) {
+        return false;
+    }
+
+    for (uint32_t i = hierarchy->sparse_capacity; i < new_capacity; i++) {
+        new_sparse[i] = -1;
+    }
+    hierarchy->sparse = new_sparse;
+    hierarchy->sparse_capacity = new_capacity;
+    return true;
+}
+
+// Trouve la position du nœud d'une entité
+static int find_node(const TransformHierarchy* hierarchy, EntityID entity_id) {
+    if (!hierarchy || entity_id == INVALID_ENTITY_ID) return -1;
+
+    uint32_t index = ENTITY_INDEX(entity_id);
+    if (index >= hierarchy->sparse_capacity) return -1;
+
+    // Un ID périmé désigne le même index mais pas la même entité
+    int slot = hierarchy->sparse[index];
+    if (slot < 0 || hierarchy->nodes[slot].entity != entity_id) return -1;
+    return slot;
+}
+
+// Retire le nœud à une position (le dernier nœud comble le trou)
+static void remove_node_at(TransformHierarchy* hierarchy, int slot) {
+    // Les enfants deviennent des racines
+    int last = hierarchy->count - 1;
+    for (int i = 0; i < hierarchy->count; i++) {
+        TransformNode* node = &hierarchy->nodes[i];
+        if (node->parent == slot) {
+            node->parent = -1;
+            node->dirty = true;
+        } else if (node->parent == last) {
+            // Le dernier nœud va prendre la place du nœud retiré
+            node->parent = slot;
+        }
+    }
+
+    hierarchy->sparse[ENTITY_INDEX(hierarchy->nodes[slot].entity)] = -1;
+    if (slot < last) {
+        hierarchy->nodes[slot] = hierarchy->nodes[last];
+        hierarchy->sparse[ENTITY_INDEX(hierarchy->nodes[slot].entity)] = slot;
+    }
+    hierarchy->count--;
+
+    // Le déplacement et les nouvelles racines cassent l'ordre par profondeur
+    hierarchy->order_dirty = true;
+}
+
+// Ajoute une entité comme racine, ou renvoie son nœud si elle est déjà présente
+static int add_node(TransformHierarchy* hierarchy, EntityID entity_id) {
+    int slot = find_node(hierarchy, entity_id);
+    if (slot >= 0) return slot;
+
+    uint32_t index = ENTITY_INDEX(entity_id);
+    if (!ensure_sparse(hierarchy, index)) return -1;
+
+    // Index recyclé avant le retrait de l'ancienne génération : l'évincer
+    // (ses enfants deviennent des racines), sinon son nœud resterait orphelin
+    if (hierarchy->sparse[index] >= 0) {
+        remove_node_at(hierarchy, hierarchy->sparse[index]);
+    }
+
+    if (hierarchy->count >= hierarchy->capacity) {
+        int new_capacity = hierarchy->capacity ? hierarchy->capacity * 2 : INITIAL_NODE_CAPACITY;
+        TransformNode* new_nodes = (TransformNode*)realloc(hierarchy->nodes, new_capacity * sizeof(TransformNode));
+        if (!check_ptr(new_nodes, LOG_LEVEL_ERROR, "Échec d'agrandissement des nœuds de la hiérarchie")) {
+            return -1;
+        }
+        hierarchy->nodes = new_nodes;
+        hierarchy->capacity = new_capacity;
+    }
+
+    // Une racine ajoutée en fin de tableau respecte l'ordre par profondeur
+    slot = hierarchy->count++;
+    TransformNode* node = &hierarchy->nodes[slot];
+    node->entity = entity_id;
+    node->parent = -1;
+    node->depth = 0;
+    node->dirty = true;
+    node->updated_pass = 0;
+    node->local = identity_transform;
+    node->world = identity_transform;
+    hierarchy->sparse[index] = slot;
+    return slot;
+}
+
+// Retrie les nœuds par profondeur (tri par comptage stable) après un changement de liens
+static bool rebuild_order(TransformHierarchy* hierarchy) {
+    int count = hierarchy->count;
+    if (count == 0) {
+        hierarchy->order_dirty = false;
+        return true;
+    }
+
+    int* depths = (int*)malloc(count * sizeof(int));
+    int* chain = (int*)malloc(count * sizeof(int));
+    int* offsets = (int*)calloc(count + 1, sizeof(int));
+    TransformNode* sorted = (TransformNode*)malloc(hierarchy->capacity * sizeof(TransformNode));
+    if (!depths || !chain || !offsets || !sorted) {
+        log_error("Échec d'allocation pour le tri de la hiérarchie");
+        free(depths);
+        free(chain);
+        free(offsets);
+        free(sorted);
+        return false;
+    }
+
+    // Profondeurs : remonter chaque chaîne jusqu'à un nœud déjà connu
+    for (int i = 0; i < count; i++) depths[i] = -1;
+    for (int i = 0; i < count; i++) {
+        int length = 0;
+        int slot = i;
+        while (slot >= 0 && depths[slot] < 0) {
+            chain[length++] = slot;
+            slot = hierarchy->nodes[slot].parent;
+        }
+
+        int depth = slot >= 0 ? depths[slot] + 1 : 0;
+        while (length > 0) {
+            depths[chain[--length]] = depth++;
+        }
+    }
+
+    // Tri par comptage : chain[ancienne position] = nouvelle position
+    for (int i = 0; i < count; i++) offsets[depths[i] + 1]++;
+    for (int depth = 0; depth < count; depth++) offsets[depth + 1] += offsets[depth];
+    for (int i = 0; i < count; i++) chain[i] = offsets[depths[i]]++;
+
+    for (int i = 0; i < count; i++) {
+        TransformNode* node = &sorted[chain[i]];
+        *node = hierarchy->nodes[i];
+        node->depth = depths[i];
+        node->parent = node->parent >= 0 ? chain[node->parent] : -1;
+        hierarchy->sparse[ENTITY_INDEX(node->entity)] = chain[i];
+    }
+
+    free(hierarchy->nodes);
+    hierarchy->nodes = sorted;
+    hierarchy->order_dirty = false;
+
+    free(depths);
+    free(chain);
+    free(offsets);
+    return true;
+}
+
+// Initialise une hiérarchie de transformations
+TransformHierarchy* transform_hierarchy_init(int initial_capacity) {
+    TransformHierarchy* hierarchy = (TransformHierarchy*)calloc(1, sizeof(TransformHierarchy));
+    if (!check_ptr(hierarchy, LOG_LEVEL_ERROR, "Échec d'allocation de la hiérarchie de transformations")) {
+        return NULL;
+    }
+
+    if (initial_capacity > 0) {
+        hierarchy->nodes = (TransformNode*)malloc(initial_capacity * sizeof(TransformNode));
+        if (!check_ptr(hierarchy->nodes, LOG_LEVEL_ERROR, "Échec d'allocation des nœuds de la hiérarchie")) {
+            free(hierarchy);
+            return NULL;
+        }
+        hierarchy->capacity = initial_capacity;
+    }
+
+    if (!ensure_sparse(hierarchy, 0)) {
+        transform_hierarchy_shutdown(hierarchy);
+        return NULL;
+    }
+
+    return hierarchy;
+}
+
+// Libère une hiérarchie de transformations
+void transform_hierarchy_shutdown(TransformHierarchy* hierarchy) {
+    if (!hierarchy) return;
+
+    free(hierarchy->nodes);
+    free(hierarchy->sparse);
+    free(hierarchy);
+}
+
+// Attache une entité à un parent
+bool transform_hierarchy_set_parent(TransformHierarchy* hierarchy, EntityID child, EntityID parent) {
+    if (!hierarchy || child == INVALID_ENTITY_ID || child == parent) return false;
+
+    // Refuser un lien dont le parent descend de l'enfant
+    int parent_slot = find_node(hierarchy, parent);
+    int child_slot = find_node(hierarchy, child);
+    if (child_slot >= 0) {
+        for (int slot = parent_slot; slot >= 0; slot = hierarchy->nodes[slot].parent) {
+            if (slot == child_slot) {
+                log_warning("Lien refusé : l'entité %u descend de l'entité %u", parent, child);
+                return false;
+            }
+        }
+    }
+
+    if (parent != INVALID_ENTITY_ID) {
+        parent_slot = add_node(hierarchy, parent);
+        if (parent_slot < 0) return false;
+    }
+    child_slot = add_node(hierarchy, child);
+    if (child_slot < 0) return false;
+
+    // L'éviction d'un nœud périmé déplace le dernier nœud, qui peut être le parent
+    parent_slot = find_node(hierarchy, parent);
+
+    TransformNode* node = &hierarchy->nodes[child_slot];
+    if (node->parent == parent_slot) return true;
+
+    node->parent = parent_slot;
+    node->dirty = true;
+
+    // Un parent rangé après son enfant impose de retrier avant le prochain passage
+    if (parent_slot > child_slot || node->depth != (parent_slot >= 0 ? hierarchy->nodes[parent_slot].depth + 1 : 0)) {
+        hierarchy->order_dirty = true;
+    }
+    return true;
+}
+
+// Retire une entité de la hiérarchie
+bool transform_hierarchy_remove(TransformHierarchy* hierarchy, EntityID entity_id) {
+    int slot = find_node(hierarchy, entity_id);
+    if (slot < 0) return false;
+
+    remove_node_at(hierarchy, slot);
+    return true;
+}
+
+// Récupère le parent d'une entité
+EntityID transform_hierarchy_get_parent(const TransformHierarchy* hierarchy, EntityID entity_id) {
+    int slot = find_node(hierarchy, entity_id);
+    if (slot < 0 || hierarchy->nodes[slot].parent < 0) return INVALID_ENTITY_ID;
+
+    return hierarchy->nodes[hierarchy->nodes[slot].parent].entity;
+}
+
+// Recalcule les transformations monde en un seul parcours linéaire
+int transform_hierarchy_update(TransformHierarchy* hierarchy, EntityManager* manager) {
+    if (!hierarchy || !manager) return 0;
+
+    if (hierarchy->order_dirty && !rebuild_order(hierarchy)) return 0;
+
+    // Les Transform modifiés pendant le tick du passage précédent sont repris :
+    // une modification faite après ce passage, dans le même tick, n'est pas perdue
+    uint32_t since_tick = hierarchy->last_tick;
+    uint32_t pass = ++hierarchy->pass;
+    int updated = 0;
+
+    // Les parents précèdent leurs enfants : un seul parcours suffit
+    for (int i = 0; i < hierarchy->count; i++) {
+        TransformNode* node = &hierarchy->nodes[i];
+
+        uint32_t tick = entity_get_change_tick(manager, node->entity, COMPONENT_TRANSFORM);
+        bool local_changed = tick != 0 && tick >= since_tick;
+        if (local_changed || node->dirty) {
+            const TransformComponent* transform = (const TransformComponent*)entity_get_component(
+                manager, node->entity, COMPONENT_TRANSFORM
+            );
+            node->local = transform ? local_from_component(transform) : identity_transform;
+        }
+
+        const TransformNode* parent = node->parent >= 0 ? &hierarchy->nodes[node->parent] : NULL;
+        if (!local_changed && !node->dirty && (!parent || parent->updated_pass != pass)) continue;
+
+        node->world = parent ? compose(&parent->world, &node->local) : node->local;
+        node->dirty = false;
+        node->updated_pass = pass;
+        updated++;
+    }
+
+    hierarchy->last_tick = manager->change_tick;
+    return updated;
+}
+
+// Récupère la transformation monde en cache d'une entité
+bool transform_hierarchy_get_world(const TransformHierarchy* hierarchy, EntityID entity_id,
+                                   AffineTransform* out_world) {
+    int slot = find_node(hierarchy, entity_id);
+    if (slot < 0 || !out_world) return false;
+
+    *out_world = hierarchy->nodes[slot].world;
+    return true;
+}
@@ -0,0 +1,106 @@
+/**
+ * transform_hierarchy.h
+ * Hiérarchie de transformations : liens parent-enfant et transformations monde en cache
+ */
+
+#ifndef TRANSFORM_HIERARCHY_H
+#define TRANSFORM_HIERARCHY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../core/entity.h"
+#include "../systems/entity_manager.h"
+
+// Matrice affine 2D : x' = a * x + c * y + tx, y' = b * x + d * y + ty
+typedef struct {
+    float a, b;    // Première colonne (axe X transformé)
+    float c, d;    // Deuxième colonne (axe Y transformé)
+    float tx, ty;  // Translation
+} AffineTransform;
+
+// Nœud de la hiérarchie (les parents sont toujours rangés avant leurs enfants)
+typedef struct {
+    EntityID entity;          // Entité du nœud
+    int parent;               // Position du nœud parent (-1 pour une racine)
+    int depth;                // Profondeur (0 pour une racine)
+    bool dirty;               // Transformation monde à recalculer au prochain passage
+    uint32_t updated_pass;    // Dernier passage ayant recalculé la transformation monde
+    AffineTransform local;    // Transformation locale (copie du TransformComponent)
+    AffineTransform world;    // Transformation monde en cache
+} TransformNode;
+
+// Hiérarchie de transformations
+// Le TransformComponent d'un enfant est interprété comme relatif à son parent.
+typedef struct {
+    TransformNode* nodes;      // Nœuds triés par profondeur
+    int count;                 // Nombre de nœuds
+    int capacity;              // Capacité du tableau de nœuds
+    int* sparse;               // Index d'entité -> position du nœud (-1 si absent)
+    uint32_t sparse_capacity;  // Taille du tableau sparse
+    bool order_dirty;          // Liens modifiés : nœuds à retrier par profondeur
+    uint32_t pass;             // Numéro du dernier passage de mise à jour
+    uint32_t last_tick;        // Tick du gestionnaire au dernier passage
+} TransformHierarchy;
+
+/**
+ * Initialise une hiérarchie de transformations
+ * @param initial_capacity Nombre de nœuds à réserver
+ * @return Pointeur vers la hiérarchie ou NULL en cas d'erreur
+ */
+TransformHierarchy* transform_hierarchy_init(int initial_capacity);
+
+/**
+ * Libère une hiérarchie de transformations
+ * @param hierarchy Hiérarchie à libérer
+ */
+void transform_hierarchy_shutdown(TransformHierarchy* hierarchy);
+
+/**
+ * Attache une entité à un parent (ou la détache avec INVALID_ENTITY_ID)
+ * Les entités absentes de la hiérarchie y sont ajoutées ; une ancienne génération
+ * encore présente au même index d'entité en est d'abord retirée (ses enfants
+ * deviennent des racines). Un lien qui créerait un cycle est refusé.
+ * @param hierarchy Hiérarchie de transformations
+ * @param child Entité enfant
+ * @param parent Entité parente ou INVALID_ENTITY_ID pour en faire une racine
+ * @return true si le lien a été établi, false sinon
+ */
+bool transform_hierarchy_set_parent(TransformHierarchy* hierarchy, EntityID child, EntityID parent);
+
+/**
+ * Retire une entité de la hiérarchie (ses enfants deviennent des racines)
+ * @param hierarchy Hiérarchie de transformations
+ * @param entity_id ID de l'entité
+ * @return true si l'entité a été retirée, false si elle n'y était pas
+ */
+bool transform_hierarchy_remove(TransformHierarchy* hierarchy, EntityID entity_id);
+
+/**
+ * Récupère le parent d'une entité
+ * @param hierarchy Hiérarchie de transformations
+ * @param entity_id ID de l'entité
+ * @return ID du parent ou INVALID_ENTITY_ID pour une racine ou une entité absente
+ */
+EntityID transform_hierarchy_get_parent(const TransformHierarchy* hierarchy, EntityID entity_id);
+
+/**
+ * Recalcule les transformations monde en un seul parcours linéaire, par profondeur
+ * Seuls les nœuds dont le Transform a changé depuis le passage précédent (voir
+ * entity_mark_changed) et leurs descendants sont recalculés.
+ * @param hierarchy Hiérarchie de transformations
+ * @param manager Gestionnaire d'entités
+ * @return Nombre de transformations monde recalculées
+ */
+int transform_hierarchy_update(TransformHierarchy* hierarchy, EntityManager* manager);
+
+/**
+ * Récupère la transformation monde en cache d'une entité
+ * @param hierarchy Hiérarchie de transformations
+ * @param entity_id ID de l'entité
+ * @param out_world Reçoit la transformation monde
+ * @return true si l'entité est dans la hiérarchie, false sinon
+ */
+bool transform_hierarchy_get_world(const TransformHierarchy* hierarchy, EntityID entity_id,
+                                   AffineTransform* out_world);
+
+#endif /* TRANSFORM_HIERARCHY_H */
@@ -0,0 +1,227 @@
+/**
+ * transform_pool.c
+ * Implémentation du stockage SoA des transformations
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../systems/transform_pool.h"
+#include "../utils/error_handler.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define TRANSFORM_USE_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TRANSFORM_USE_SSE2 1
+#endif
+
+// Capacité initiale du tableau sparse
+#define INITIAL_SPARSE_CAPACITY 1024
+
+// Agrandit une colonne de flottants
+static bool grow_column(float** column, int new_capacity) {
+    float* new_column = (float*)realloc(*column, new_capacity * sizeof(float));
+    if (!check_ptr(new_column, LOG_LEVEL_ERROR, "Échec d'agrandissement d'une colonne de transformations")) {
+        return false;
+    }
+    *column = new_column;
+    return true;
+}
+
+// Réalloue toutes les colonnes à une nouvelle capacité
+static bool reserve_capacity(TransformPool* pool, int new_capacity) {
+    if (!grow_column(&pool->x, new_capacity) ||
+        !grow_column(&pool->y, new_capacity) ||
+        !grow_column(&pool->rotation, new_capacity) ||
+        !grow_column(&pool->scale_x, new_capacity) ||
+        !grow_column(&pool->scale_y, new_capacity)) {
+        return false;
+    }
+
+    EntityID* new_entities = (EntityID*)realloc(pool->entities, new_capacity * sizeof(EntityID));
+    if (!check_ptr(new_entities, LOG_LEVEL_ERROR, "Échec d'agrandissement des entités du pool de transformations")) {
+        return false;
+    }
+    pool->entities = new_entities;
+    pool->capacity = new_capacity;
+    return true;
+}
+
+// Garantit la place pour une entrée de plus
+static bool ensure_capacity(TransformPool* pool) {
+    if (pool->count < pool->capacity) return true;
+
+    return reserve_capacity(pool, pool->capacity ? pool->capacity * 2 : TRANSFORM_SIMD_WIDTH * 32);
+}
+
+// Garantit que l'index sparse couvre un index d'entité
+static bool ensure_sparse(TransformPool* pool, uint32_t index) {
+    if (index < pool->sparse_capacity) return true;
+
+    uint32_t new_capacity = pool->sparse_capacity ? pool->sparse_capacity : INITIAL_SPARSE_CAPACITY;
+    while (new_capacity <= index) {
+        new_capacity *= 2;
+    }
+
+    int* new_sparse = (int*)realloc(pool->sparse, new_capacity * sizeof(int));
+    if (!check_ptr(new_sparse, LOG_LEVEL_ERROR, "Échec d'agrandissement de l'index du pool de transformations")) {
+        return false;
+    }
+
+    for (uint32_t i = pool->sparse_capacity; i < new_capacity; i++) {
+        new_sparse[i] = -1;
+    }
+    pool->sparse = new_sparse;
+    pool->sparse_capacity = new_capacity;
+    return true;
+}
+
+// Initialise un pool de transformations
+TransformPool* transform_pool_init(int initial_capacity) {
+    TransformPool* pool = (TransformPool*)calloc(1, sizeof(TransformPool));
+    if (!check_ptr(pool, LOG_LEVEL_ERROR, "Échec d'allocation du pool de transformations")) {
+        return NULL;
+    }
+
+    // Arrondir la capacité à un multiple de la largeur vectorielle
+    int capacity = (initial_capacity + TRANSFORM_SIMD_WIDTH - 1) & ~(TRANSFORM_SIMD_WIDTH - 1);
+    if ((capacity > 0 && !reserve_capacity(pool, capacity)) || !ensure_sparse(pool, 0)) {
+        transform_pool_shutdown(pool);
+        return NULL;
+    }
+
+    return pool;
+}
+
+// Libère un pool de transformations
+void transform_pool_shutdown(TransformPool* pool) {
+    if (!pool) return;
+
+    free(pool->x);
+    free(pool->y);
+    free(pool->rotation);
+    free(pool->scale_x);
+    free(pool->scale_y);
+    free(pool->entities);
+    free(pool->sparse);
+    free(pool);
+}
+
+// Ajoute une entité au pool
+int transform_pool_add(TransformPool* pool, const TransformComponent* transform) {
+    if (!pool || !transform || transform->base.entity == INVALID_ENTITY_ID) return -1;
+
+    EntityID entity_id = transform->base.entity;
+    uint32_t index = ENTITY_INDEX(entity_id);
+    if (!ensure_sparse(pool, index)) return -1;
+
+    // Entité pas encore suivie : reprendre l'entrée d'une ancienne génération du même
+    // index, qui resterait sinon intégrée sans plus pouvoir être retirée, ou en créer une
+    int slot = pool->sparse[index];
+    if (slot < 0) {
+        if (!ensure_capacity(pool)) return -1;
+
+        slot = pool->count++;
+        pool->sparse[index] = slot;
+    }
+    pool->entities[slot] = entity_id;
+
+    pool->x[slot] = transform->x;
+    pool->y[slot] = transform->y;
+    pool->rotation[slot] = transform->rotation;
+    pool->scale_x[slot] = transform->scale_x;
+    pool->scale_y[slot] = transform->scale_y;
+    return slot;
+}
+
+// Retire une entité du pool
+bool transform_pool_remove(TransformPool* pool, EntityID entity_id) {
+    int slot = transform_pool_find(pool, entity_id);
+    if (slot < 0) return false;
+
+    int last = pool->count - 1;
+
+    // Déplacer la dernière entrée à la place de celle retirée
+    if (slot < last) {
+        pool->x[slot] = pool->x[last];
+        pool->y[slot] = pool->y[last];
+        pool->rotation[slot] = pool->rotation[last];
+        pool->scale_x[slot] = pool->scale_x[last];
+        pool->scale_y[slot] = pool->scale_y[last];
+        pool->entities[slot] = pool->entities[last];
+        pool->sparse[ENTITY_INDEX(pool->entities[slot])] = slot;
+    }
+
+    pool->sparse[ENTITY_INDEX(entity_id)] = -1;
+    pool->count--;
+    return true;
+}
+
+// Trouve l'entrée d'une entité
+int transform_pool_find(const TransformPool* pool, EntityID entity_id) {
+    if (!pool || entity_id == INVALID_ENTITY_ID) return -1;
+
+    uint32_t index = ENTITY_INDEX(entity_id);
+    if (index >= pool->sparse_capacity) return -1;
+
+    // Une entrée réutilisée par une autre génération ne correspond pas
+    int slot = pool->sparse[index];
+    return (slot >= 0 && pool->entities[slot] == entity_id) ? slot : -1;
+}
+
+// Ajoute un déplacement à une colonne (noyau vectoriel puis reste scalaire)
+static void integrate_column(float* position, const float* delta, int count) {
+    int i = 0;
+
+#if defined(TRANSFORM_USE_AVX)
+    for (; i + 8 <= count; i += 8) {
+        __m256 p = _mm256_loadu_ps(position + i);
+        __m256 d = _mm256_loadu_ps(delta + i);
+        _mm256_storeu_ps(position + i, _mm256_add_ps(p, d));
+    }
+#elif defined(TRANSFORM_USE_SSE2)
+    for (; i + 4 <= count; i += 4) {
+        __m128 p = _mm_loadu_ps(position + i);
+        __m128 d = _mm_loadu_ps(delta + i);
+        _mm_storeu_ps(position + i, _mm_add_ps(p, d));
+    }
+#endif
+
+    for (; i < count; i++) {
+        position[i] += delta[i];
+    }
+}
+
+// Ajoute un déplacement à toutes les positions du pool
+void transform_integrate(TransformPool* pool, const float* dx, const float* dy) {
+    if (!pool || pool->count == 0) return;
+
+    if (dx) integrate_column(pool->x, dx, pool->count);
+    if (dy) integrate_column(pool->y, dy, pool->count);
+}
+
+// Recopie les transformations du pool dans les composants des entités
+int transform_pool_write_back(const TransformPool* pool, EntityManager* manager) {
+    if (!pool || !manager) return 0;
+
+    int updated = 0;
+    for (int i = 0; i < pool->count; i++) {
+        if (!entity_has_component(manager, pool->entities[i], COMPONENT_TRANSFORM)) continue;
+
+        TransformComponent* transform = (TransformComponent*)entity_get_component(
+            manager, pool->entities[i], COMPONENT_TRANSFORM
+        );
+        if (!transform) continue;
+
+        transform->x = pool->x[i];
+        transform->y = pool->y[i];
+        transform->rotation = pool->rotation[i];
+        transform->scale_x = pool->scale_x[i];
+        transform->scale_y = pool->scale_y[i];
+        entity_mark_changed(manager, pool->entities[i], COMPONENT_TRANSFORM);
+        updated++;
+    }
+
+    return updated;
+}
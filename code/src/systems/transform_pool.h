@@ -0,0 +1,86 @@
+/**
+ * transform_pool.h
+ * Stockage SoA des transformations et intégration vectorisée des positions
+ */
+
+#ifndef TRANSFORM_POOL_H
+#define TRANSFORM_POOL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../core/entity.h"
+#include "../systems/entity_manager.h"
+
+// Nombre de flottants traités par itération vectorielle (largeur AVX)
+#define TRANSFORM_SIMD_WIDTH 8
+
+// Pool de transformations en colonnes : une entrée par entité suivie
+typedef struct {
+    float* x;                  // Positions X
+    float* y;                  // Positions Y
+    float* rotation;           // Rotations en degrés
+    float* scale_x;            // Échelles X
+    float* scale_y;            // Échelles Y
+    EntityID* entities;        // Entité propriétaire de chaque entrée
+    int count;                 // Nombre d'entrées
+    int capacity;              // Capacité allouée (multiple de TRANSFORM_SIMD_WIDTH)
+    int* sparse;               // Index d'entité -> entrée dense (-1 si absente)
+    uint32_t sparse_capacity;  // Taille du tableau sparse
+} TransformPool;
+
+/**
+ * Initialise un pool de transformations
+ * @param initial_capacity Nombre d'entrées à réserver
+ * @return Pointeur vers le pool ou NULL en cas d'erreur
+ */
+TransformPool* transform_pool_init(int initial_capacity);
+
+/**
+ * Libère un pool de transformations
+ * @param pool Pool à libérer
+ */
+void transform_pool_shutdown(TransformPool* pool);
+
+/**
+ * Ajoute une entité au pool (ou met à jour son entrée si elle y est déjà)
+ * L'entrée d'une ancienne génération encore présente au même index d'entité est reprise.
+ * @param pool Pool de transformations
+ * @param transform Transformation à copier (base.entity désigne l'entité)
+ * @return Index de l'entrée ou -1 en cas d'erreur
+ */
+int transform_pool_add(TransformPool* pool, const TransformComponent* transform);
+
+/**
+ * Retire une entité du pool (la dernière entrée prend sa place)
+ * @param pool Pool de transformations
+ * @param entity_id ID de l'entité
+ * @return true si l'entité a été retirée, false sinon
+ */
+bool transform_pool_remove(TransformPool* pool, EntityID entity_id);
+
+/**
+ * Trouve l'entrée d'une entité
+ * @param pool Pool de transformations
+ * @param entity_id ID de l'entité
+ * @return Index de l'entrée ou -1 si l'entité n'est pas suivie
+ */
+int transform_pool_find(const TransformPool* pool, EntityID entity_id);
+
+/**
+ * Ajoute un déplacement à toutes les positions du pool (SSE2/AVX si disponibles)
+ * @param pool Pool de transformations
+ * @param dx Déplacements X, indexés comme les entrées du pool (pool->count valeurs)
+ * @param dy Déplacements Y, indexés comme les entrées du pool (pool->count valeurs)
+ */
+void transform_integrate(TransformPool* pool, const float* dx, const float* dy);
+
+/**
+ * Recopie les transformations du pool dans les composants des entités
+ * Les composants recopiés sont marqués modifiés au tick courant.
+ * @param pool Pool de transformations
+ * @param manager Gestionnaire d'entités
+ * @return Nombre de composants mis à jour
+ */
+int transform_pool_write_back(const TransformPool* pool, EntityManager* manager);
+
+#endif /* TRANSFORM_POOL_H */
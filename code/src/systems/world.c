@@ -73,6 +73,7 @@ int world_system_add_transition_point(WorldSystem* system,
     // Initialiser le nouveau point de transition
     TransitionPoint* point = &system->current_map->transitions[new_id];
     point->id = new_id;
+    point->entity_id = INVALID_ENTITY_ID;
     point->x = x;
     point->y = y;
     point->width = width;
@@ -93,29 +94,36 @@ int world_system_add_transition_point(WorldSystem* system,
     // Créer également une entité pour ce point de transition
     EntityID entity_id = entity_create(system->entity_manager);
     if (entity_id != INVALID_ENTITY_ID) {
-        // Ajouter les composants nécessaires
-        TransformComponent* transform = create_transform_component(entity_id, x, y);
+        point->entity_id = entity_id;
+        
+        // Ajouter les composants nécessaires, construits directement dans le stockage
+        TransformComponent* transform = (TransformComponent*)entity_emplace_component(
+            system->entity_manager, entity_id, COMPONENT_TRANSFORM
+        );
         if (transform) {
-            entity_add_component(system->entity_manager, entity_id, transform);
+            init_transform_component(transform, entity_id, x, y);
         }
         
         // Ajouter un collider déclenché par le joueur
-        ColliderComponent* collider = create_collider_component(
-            entity_id, width, height, true
+        ColliderComponent* collider = (ColliderComponent*)entity_emplace_component(
+            system->entity_manager, entity_id, COMPONENT_COLLIDER
         );
         if (collider) {
-            entity_add_component(system->entity_manager, entity_id, collider);
+            init_collider_component(collider, entity_id, width, height, COLLISION_TRIGGER);
         }
         
+        // Le tag inscrit l'entité dans la vue des déclencheurs de la physique
+        entity_set_tag(system->entity_manager, entity_id, COMPONENT_TAG_TRIGGER, true);
+        
         // Ajouter un composant Interactable pour la transition
         int transition_type = 0; // Type de base pour les transitions
         float interaction_radius = 0.0f; // Pas besoin de rayon pour les colliders
         
-        InteractableComponent* interactable = create_interactable_component(
-            entity_id, transition_type, interaction_radius
+        InteractableComponent* interactable = (InteractableComponent*)entity_emplace_component(
+            system->entity_manager, entity_id, COMPONENT_INTERACTABLE
         );
         if (interactable) {
-            entity_add_component(system->entity_manager, entity_id, interactable);
+            init_interactable_component(interactable, entity_id, transition_type, interaction_radius);
         }
     }
     
@@ -134,6 +142,11 @@ bool world_system_remove_transition_point(WorldSystem* system, int id) {
         free(system->current_map->transitions[id].target_map);
     }
     
+    // Détruire le déclencheur associé
+    if (system->current_map->transitions[id].entity_id != INVALID_ENTITY_ID) {
+        entity_destroy(system->entity_manager, system->current_map->transitions[id].entity_id);
+    }
+    
     // Déplacer les points suivants pour maintenir un tableau compact
     for (int i = id; i < system->current_map->transition_count - 1; i++) {
         system->current_map->transitions[i] = system->current_map->transitions[i + 1];
@@ -164,36 +177,19 @@ bool world_system_remove_transition_point(WorldSystem* system, int id) {
 }
 
 // Vérifie si le joueur est entré dans une zone de transition
-int world_system_check_transition(WorldSystem* system) {
-    if (!system || !system->current_map || system->player_entity == INVALID_ENTITY_ID) {
+int world_system_check_transition(WorldSystem* system, const ContactPair* enter_events, int enter_count) {
+    if (!system || !system->current_map || system->player_entity == INVALID_ENTITY_ID || !enter_events) {
         return -1;
     }
     
-    // Obtenir la position du joueur
-    TransformComponent* player_transform = (TransformComponent*)entity_get_component(
-        system->entity_manager, system->player_entity, COMPONENT_TRANSFORM
-    );
-    
-    if (!player_transform) {
-        return -1;
-    }
-    
-    float player_x = player_transform->x;
-    float player_y = player_transform->y;
-    
-    // Vérifier tous les points de transition
-    for (int i = 0; i < system->current_map->transition_count; i++) {
-        TransitionPoint* point = &system->current_map->transitions[i];
-        
-        // Calculer les limites de la zone de transition
-        float min_x = point->x - point->width / 2.0f;
-        float max_x = point->x + point->width / 2.0f;
-        float min_y = point->y - point->height / 2.0f;
-        float max_y = point->y + point->height / 2.0f;
+    // Chaque entrée associe un déclencheur (a) à l'entité qui y pénètre (b)
+    for (int e = 0; e < enter_count; e++) {
+        if (enter_events[e].b != system->player_entity) continue;
         
-        // Vérifier si le joueur est dans la zone
-        if (player_x >= min_x && player_x <= max_x && player_y >= min_y && player_y <= max_y) {
-            return i;
+        for (int i = 0; i < system->current_map->transition_count; i++) {
+            if (system->current_map->transitions[i].entity_id == enter_events[e].a) {
+                return i;
+            }
         }
     }
     
@@ -315,6 +311,163 @@ int world_system_find_nearest_interactive_object(WorldSystem* system, float max_
     return nearest_id;
 }
 
+// Indique si une tuile est traversable sur toutes ses couches
+static bool tile_stack_is_walkable(const Chunk* chunk, int local_x, int local_y) {
+    for (int layer = 0; layer < LAYER_COUNT; layer++) {
+        const Tile* tile = &chunk->tiles[local_x][local_y][layer];
+        if (tile->type != TILE_NONE && !tile->is_walkable) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Reconstruit les bits de traversabilité d'un chunk à partir de ses tuiles
+void world_chunk_build_walkability(Chunk* chunk) {
+    if (!chunk) return;
+    
+    memset(chunk->walkable, 0, sizeof(chunk->walkable));
+    for (int y = 0; y < CHUNK_TILES; y++) {
+        for (int x = 0; x < CHUNK_TILES; x++) {
+            if (tile_stack_is_walkable(chunk, x, y)) {
+                int bit = y * CHUNK_TILES + x;
+                chunk->walkable[bit >> 6] |= 1ull << (bit & 63);
+            }
+        }
+    }
+}
+
+// Met à jour le bit de traversabilité d'une tuile après sa modification
+void world_chunk_update_walkability(Chunk* chunk, int local_x, int local_y) {
+    if (!chunk || local_x < 0 || local_x >= CHUNK_TILES || local_y < 0 || local_y >= CHUNK_TILES) return;
+    
+    int bit = local_y * CHUNK_TILES + local_x;
+    if (tile_stack_is_walkable(chunk, local_x, local_y)) {
+        chunk->walkable[bit >> 6] |= 1ull << (bit & 63);
+    } else {
+        chunk->walkable[bit >> 6] &= ~(1ull << (bit & 63));
+    }
+}
+
+// Vérifie si une tuile de la carte est traversable
+bool world_map_is_tile_walkable(const Map* map, int tile_x, int tile_y) {
+    if (!map || !map->chunks || tile_x < 0 || tile_y < 0 ||
+        tile_x >= map->chunks_x * CHUNK_TILES || tile_y >= map->chunks_y * CHUNK_TILES) {
+        return false;
+    }
+    
+    const Chunk* chunk = map->chunks[(tile_y / CHUNK_TILES) * map->chunks_x + tile_x / CHUNK_TILES];
+    if (!chunk || !chunk->is_loaded) return false;
+    
+    int bit = (tile_y % CHUNK_TILES) * CHUNK_TILES + tile_x % CHUNK_TILES;
+    return (chunk->walkable[bit >> 6] >> (bit & 63)) & 1u;
+}
+
+// Vérifie qu'une zone ne chevauche que des tuiles traversables
+bool world_map_is_area_walkable(const Map* map, float min_x, float min_y, float max_x, float max_y) {
+    if (!map || !map->chunks || map->tile_size <= 0) return false;
+    
+    // Tuiles touchées (une boîte qui affleure le bord d'une tuile ne la chevauche pas)
+    float inverse_tile_size = 1.0f / (float)map->tile_size;
+    int tile_min_x = (int)floorf(min_x * inverse_tile_size);
+    int tile_min_y = (int)floorf(min_y * inverse_tile_size);
+    int tile_max_x = (int)ceilf(max_x * inverse_tile_size) - 1;
+    int tile_max_y = (int)ceilf(max_y * inverse_tile_size) - 1;
+    if (tile_max_x < tile_min_x) tile_max_x = tile_min_x;
+    if (tile_max_y < tile_min_y) tile_max_y = tile_min_y;
+    
+    // Hors de la carte : bloquant
+    if (tile_min_x < 0 || tile_min_y < 0 ||
+        tile_max_x >= map->chunks_x * CHUNK_TILES || tile_max_y >= map->chunks_y * CHUNK_TILES) {
+        return false;
+    }
+    
+    for (int cy = tile_min_y / CHUNK_TILES; cy <= tile_max_y / CHUNK_TILES; cy++) {
+        for (int cx = tile_min_x / CHUNK_TILES; cx <= tile_max_x / CHUNK_TILES; cx++) {
+            const Chunk* chunk = map->chunks[cy * map->chunks_x + cx];
+            if (!chunk || !chunk->is_loaded) return false;
+            
+            // Colonnes et lignes de la zone à l'intérieur de ce chunk
+            int first_x = tile_min_x - cx * CHUNK_TILES;
+            int last_x = tile_max_x - cx * CHUNK_TILES;
+            int first_y = tile_min_y - cy * CHUNK_TILES;
+            int last_y = tile_max_y - cy * CHUNK_TILES;
+            if (first_x < 0) first_x = 0;
+            if (last_x >= CHUNK_TILES) last_x = CHUNK_TILES - 1;
+            if (first_y < 0) first_y = 0;
+            if (last_y >= CHUNK_TILES) last_y = CHUNK_TILES - 1;
+            
+            // Une ligne du chunk tient dans 16 bits : un masque la teste d'un coup
+            uint32_t mask = ((1u << (last_x - first_x + 1)) - 1u) << first_x;
+            for (int y = first_y; y <= last_y; y++) {
+                uint32_t row = (uint32_t)(chunk->walkable[y >> 2] >> ((y & 3) * CHUNK_TILES)) & 0xFFFFu;
+                if ((row & mask) != mask) return false;
+            }
+        }
+    }
+    
+    return true;
+}
+
+// Vérifie si une position est traversable
+bool world_system_is_walkable(WorldSystem* system, float x, float y) {
+    if (!system) return false;
+    return world_map_is_area_walkable(system->current_map, x, y, x, y);
+}
+
+// Définit une tuile sur la carte
+bool world_system_set_tile(WorldSystem* system, int x, int y, MapLayer layer, Tile tile) {
+    if (!system || !system->current_map || layer < 0 || layer >= LAYER_COUNT) return false;
+    
+    Map* map = system->current_map;
+    if (x < 0 || y < 0 || x >= map->chunks_x * CHUNK_TILES || y >= map->chunks_y * CHUNK_TILES) {
+        return false;
+    }
+    
+    Chunk* chunk = map->chunks[(y / CHUNK_TILES) * map->chunks_x + x / CHUNK_TILES];
+    if (!chunk) return false;
+    
+    int local_x = x % CHUNK_TILES;
+    int local_y = y % CHUNK_TILES;
+    chunk->tiles[local_x][local_y][layer] = tile;
+    chunk->is_dirty = true;
+    
+    // Garder la traversabilité du chunk synchronisée avec ses tuiles
+    world_chunk_update_walkability(chunk, local_x, local_y);
+    return true;
+}
+
+// Dessine les entités visibles à leur position interpolée
+void world_system_render_entities(WorldSystem* system, RenderSystem* render_system, float alpha) {
+    if (!system || !render_system) return;
+    
+    // La vue existe dès la première image : l'enregistrement ne fait ensuite que la retrouver
+    EntityQuery* query = entity_query_register(
+        system->entity_manager, COMPONENT_BIT(COMPONENT_TRANSFORM) | COMPONENT_BIT(COMPONENT_SPRITE)
+    );
+    if (!query) return;
+    
+    for (int i = 0; i < query->count; i++) {
+        EntityID entity_id = query->entities[i];
+        SpriteComponent* sprite = (SpriteComponent*)entity_get_component(
+            system->entity_manager, entity_id, COMPONENT_SPRITE
+        );
+        TransformComponent* transform = (TransformComponent*)entity_get_component(
+            system->entity_manager, entity_id, COMPONENT_TRANSFORM
+        );
+        if (!sprite || !transform || !sprite->visible) continue;
+        
+        // Entre le dernier pas et le suivant : le mouvement reste fluide quelle que soit la fréquence d'affichage
+        float x, y;
+        interpolate_transform_component(transform, alpha, &x, &y);
+        render_system_draw_sprite(render_system, (int)sprite->texture_id,
+                                  x, y, sprite->width, sprite->height,
+                                  sprite->sprite_sheet_x, sprite->sprite_sheet_y,
+                                  sprite->width, sprite->height,
+                                  transform->rotation, transform->scale_x, transform->scale_y);
+    }
+}
+
 // ===== Modifications à apporter aux fonctions existantes =====
 
 // Modifier world_system_init pour initialiser les nouveaux champs
@@ -362,8 +515,10 @@ int world_system_find_nearest_interactive_object(WorldSystem* system, float max_
 // Modifier world_system_update pour vérifier les transitions
 // Dans la fonction world_system_update, ajouter avant la fin de la fonction:
 /*
-    // Vérifier si le joueur a déclenché une transition
-    int transition_id = world_system_check_transition(system);
+    // Vérifier si le joueur a déclenché une transition (entrées des déclencheurs de la physique)
+    const ContactPair* enter_events;
+    int enter_count = physics_get_trigger_events(physics_system, CONTACT_ENTER, &enter_events);
+    int transition_id = world_system_check_transition(system, enter_events, enter_count);
     if (transition_id >= 0 && transition_id < system->current_map->transition_count) {
         TransitionPoint* point = &system->current_map->transitions[transition_id];
         
@@ -378,4 +533,22 @@ int world_system_find_nearest_interactive_object(WorldSystem* system, float max_
             world_system_teleport_player(system, point->target_x, point->target_y);
         }
     }
+*/
+
+// Modifier world_system_render pour dessiner les positions interpolées
+// Dans la fonction world_system_render(system, render_system, alpha), remplacer le centrage
+// de la caméra et le dessin des entités par:
+/*
+    // Centrer la caméra sur la position interpolée du joueur
+    TransformComponent* player_transform = (TransformComponent*)entity_get_component(
+        system->entity_manager, system->player_entity, COMPONENT_TRANSFORM
+    );
+    if (player_transform) {
+        float camera_x, camera_y;
+        interpolate_transform_component(player_transform, alpha, &camera_x, &camera_y);
+        render_system_center_camera(render_system, camera_x, camera_y);
+    }
+    
+    // Dessiner les entités entre les deux derniers pas de simulation
+    world_system_render_entities(system, render_system, alpha);
 */
\ No newline at end of file
@@ -7,9 +7,11 @@
 #define WORLD_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <SDL2/SDL.h>
 #include "../systems/entity_manager.h"
 #include "../systems/render.h"
+#include "../systems/contact_cache.h"
 
 // Type de tuile
 typedef enum {
@@ -58,11 +60,15 @@ typedef enum {
     ZONE_COUNT
 } ZoneType;
 
+// Côté d'un chunk en tuiles
+#define CHUNK_TILES 16
+
 // Structure de chunk (section de carte)
 typedef struct {
     int chunk_x;                  // Coordonnée X du chunk dans le monde
     int chunk_y;                  // Coordonnée Y du chunk dans le monde
-    Tile tiles[16][16][LAYER_COUNT]; // Tuiles du chunk (16x16 par défaut, sur plusieurs couches)
+    Tile tiles[CHUNK_TILES][CHUNK_TILES][LAYER_COUNT]; // Tuiles du chunk (16x16, sur plusieurs couches)
+    uint64_t walkable[CHUNK_TILES * CHUNK_TILES / 64]; // Traversabilité : bit y * 16 + x à 1 si la tuile (x, y) est traversable
     bool is_loaded;               // Le chunk est-il chargé
     bool is_dirty;                // Le chunk a-t-il été modifié
 } Chunk;
@@ -75,6 +81,7 @@ typedef struct {
     ZoneType target_zone;         // Zone cible
     float target_x, target_y;     // Position cible après la transition
     char* target_map;             // Fichier de carte cible (peut être NULL)
+    EntityID entity_id;           // Entité déclencheur de la zone (INVALID_ENTITY_ID si aucune)
 } TransitionPoint;
 
 // Structure de carte
@@ -146,9 +153,6 @@ typedef struct {
     int player_texture_id;            // ID de la texture du joueur
     int objects_texture_id;           // ID de la texture des objets
     
-    // Paramètres de collision
-    bool collision_map[1024][1024];   // Carte de collision temporaire (à améliorer plus tard)
-    
     // Objets interactifs
     InteractiveObject* interactive_objects;  // Tableau des objets interactifs
     int interactive_object_count;            // Nombre d'objets interactifs
@@ -185,8 +189,9 @@ void world_system_update(WorldSystem* system, float delta_time);
  * Rend le monde à l'écran
  * @param system Système de monde
  * @param render_system Système de rendu
+ * @param alpha Fraction du pas fixe écoulée depuis le dernier pas (0 à 1), pour interpoler les Transform
  */
-void world_system_render(WorldSystem* system, RenderSystem* render_system);
+void world_system_render(WorldSystem* system, RenderSystem* render_system, float alpha);
 
 /**
  * Gère les événements clavier pour le système de monde
@@ -258,6 +263,44 @@ Tile world_system_get_tile(WorldSystem* system, int x, int y, MapLayer layer);
  */
 bool world_system_is_walkable(WorldSystem* system, float x, float y);
 
+/**
+ * Reconstruit les bits de traversabilité d'un chunk à partir de ses tuiles
+ * Une tuile est traversable si aucune de ses couches ne porte une tuile non traversable.
+ * À appeler après le chargement ou la génération du chunk.
+ * @param chunk Chunk à reconstruire
+ */
+void world_chunk_build_walkability(Chunk* chunk);
+
+/**
+ * Met à jour le bit de traversabilité d'une tuile après sa modification
+ * @param chunk Chunk contenant la tuile
+ * @param local_x Position X de la tuile dans le chunk
+ * @param local_y Position Y de la tuile dans le chunk
+ */
+void world_chunk_update_walkability(Chunk* chunk, int local_x, int local_y);
+
+/**
+ * Vérifie si une tuile de la carte est traversable
+ * @param map Carte
+ * @param tile_x Position X de la tuile
+ * @param tile_y Position Y de la tuile
+ * @return true si la tuile est traversable, false si elle bloque ou est hors de la carte
+ */
+bool world_map_is_tile_walkable(const Map* map, int tile_x, int tile_y);
+
+/**
+ * Vérifie qu'une zone ne chevauche que des tuiles traversables
+ * Chaque ligne de tuiles d'un chunk est testée d'un seul masque de bits.
+ * Les tuiles hors de la carte ou dans un chunk non chargé sont bloquantes.
+ * @param map Carte
+ * @param min_x Bord gauche de la zone en pixels
+ * @param min_y Bord haut de la zone en pixels
+ * @param max_x Bord droit de la zone en pixels
+ * @param max_y Bord bas de la zone en pixels
+ * @return true si toutes les tuiles touchées sont traversables, false sinon
+ */
+bool world_map_is_area_walkable(const Map* map, float min_x, float min_y, float max_x, float max_y);
+
 /**
  * Vérifie si une tuile est labourable
  * @param system Système de monde
@@ -344,10 +387,14 @@ bool world_system_remove_transition_point(WorldSystem* system, int id);
 
 /**
  * Vérifie si le joueur est entré dans une zone de transition
+ * Chaque point de transition est un déclencheur (COMPONENT_TAG_TRIGGER) : seules les
+ * entrées signalées par la physique sont examinées, sans test de position.
  * @param system Système de monde
+ * @param enter_events Événements CONTACT_ENTER de physics_get_trigger_events
+ * @param enter_count Nombre d'événements
  * @return ID du point de transition ou -1 si aucune transition n'est déclenchée
  */
-int world_system_check_transition(WorldSystem* system);
+int world_system_check_transition(WorldSystem* system, const ContactPair* enter_events, int enter_count);
 
 /**
  * Ajoute un objet interactif au monde
@@ -379,4 +426,13 @@ bool world_system_remove_interactive_object(WorldSystem* system, int id);
  */
 int world_system_find_nearest_interactive_object(WorldSystem* system, float max_distance);
 
+/**
+ * Dessine les entités visibles (Transform + Sprite) à leur position interpolée
+ * entre les deux derniers pas de simulation
+ * @param system Système de monde
+ * @param render_system Système de rendu
+ * @param alpha Fraction du pas fixe écoulée depuis le dernier pas (0 à 1)
+ */
+void world_system_render_entities(WorldSystem* system, RenderSystem* render_system, float alpha);
+
 #endif /* WORLD_H */
\ No newline at end of file